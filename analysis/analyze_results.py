@@ -40,18 +40,44 @@ df[["V", "density"]] = df["graph"].apply(
 # Limpiar por seguridad
 df = df.dropna(subset=["V", "density"])
 
+# =====================================================
+# Cola de prioridad: las comparaciones principales usan
+# la cola de referencia (heap binario perezoso); el resto
+# de las colas se compara en un gráfico aparte
+# =====================================================
+DEFAULT_QUEUES = ["lazy-binary", "none"]
+QUEUE_ALGORITHMS = ["Dijkstra", "BMSSP"]
+
+if "queue" in df.columns:
+    df_queues = df.copy()
+    df = df[
+        ~df["algorithm"].isin(QUEUE_ALGORITHMS) |
+        df["queue"].isin(DEFAULT_QUEUES)
+    ]
+else:
+    df_queues = None
+
+# Algoritmos de los gráficos principales (las variantes con
+# colas de buckets solo existen para pesos enteros)
+ALGORITHMS = ["Dijkstra", "BMSSP", "BellmanFord", "DeltaStepping", "BMSSP-Duan",
+              "BMSSP-Parallel", "SPFA", "BellmanFord-Parallel",
+              "BellmanFord-Yen", "Dijkstra-Dial", "Dijkstra-Radix"]
+
 # =====================================================
 # 1️⃣ TIEMPO PROMEDIO vs |V| (por densidad)
 # =====================================================
 for density in ["low", "medium", "high"]:
     plt.figure(figsize=(7, 5))
 
-    for algo in ["Dijkstra", "BMSSP", "BellmanFord"]:
+    for algo in ALGORITHMS:
         data = df[
             (df["algorithm"] == algo) &
             (df["density"] == density)
         ].sort_values("V")
 
+        if data.empty:
+            continue
+
         plt.plot(
             data["V"],
             data["mean_ms"],
@@ -78,12 +104,15 @@ for density in ["low", "medium", "high"]:
 for density in ["low", "medium", "high"]:
     plt.figure(figsize=(7, 5))
 
-    for algo in ["Dijkstra", "BMSSP", "BellmanFord"]:
+    for algo in ALGORITHMS:
         data = df[
             (df["algorithm"] == algo) &
             (df["density"] == density)
         ].sort_values("V")
 
+        if data.empty:
+            continue
+
         plt.plot(
             data["V"],
             data["stddev_ms"],
@@ -110,12 +139,15 @@ for density in ["low", "medium", "high"]:
 for density in ["low", "medium", "high"]:
     plt.figure(figsize=(7, 5))
 
-    for algo in ["Dijkstra", "BMSSP", "BellmanFord"]:
+    for algo in ALGORITHMS:
         data = df[
             (df["algorithm"] == algo) &
             (df["density"] == density)
         ].sort_values("V")
 
+        if data.empty:
+            continue
+
         plt.plot(
             data["V"],
             data["instructions"],
@@ -136,4 +168,42 @@ for density in ["low", "medium", "high"]:
     plt.close()
     print(f"Guardado {out}")
 
+# =====================================================
+# 4️⃣ TIEMPO POR COLA DE PRIORIDAD (por densidad)
+# =====================================================
+if df_queues is not None:
+    for density in ["low", "medium", "high"]:
+        plt.figure(figsize=(7, 5))
+
+        for algo in QUEUE_ALGORITHMS:
+            for queue in sorted(df_queues["queue"].unique()):
+                data = df_queues[
+                    (df_queues["algorithm"] == algo) &
+                    (df_queues["queue"] == queue) &
+                    (df_queues["density"] == density)
+                ].sort_values("V")
+
+                if data.empty:
+                    continue
+
+                plt.plot(
+                    data["V"],
+                    data["mean_ms"],
+                    marker="o",
+                    label=f"{algo} ({queue})"
+                )
+
+        plt.xscale("log")
+        plt.yscale("log")
+        plt.xlabel("Número de vértices |V|")
+        plt.ylabel("Tiempo promedio (ms)")
+        plt.title(f"Colas de prioridad — Densidad {density}")
+        plt.legend()
+        plt.grid(True, which="both", linestyle="--", alpha=0.5)
+
+        out = str(PLOTS_DIR / f"queues_{density}.png")
+        plt.savefig(out)
+        plt.close()
+        print(f"Guardado {out}")
+
 print("\nAnálisis completado. Revisa results/plots/")
@@ -29,14 +29,29 @@ df["V"], df["density"] = zip(
 
 df = df.dropna()
 
+# Comparar con la cola de prioridad de referencia
+if "queue" in df.columns:
+    df = df[
+        ~df["algorithm"].isin(["Dijkstra", "BMSSP"]) |
+        df["queue"].isin(["lazy-binary", "none"])
+    ]
+
 # -----------------------------------------
 # Algoritmos y comparaciones por pares
 # -----------------------------------------
-algorithms = ["Dijkstra", "BMSSP", "BellmanFord"]
+algorithms = ["Dijkstra", "BMSSP", "BellmanFord", "DeltaStepping", "BMSSP-Duan",
+              "BMSSP-Parallel", "SPFA", "BellmanFord-Parallel",
+              "BellmanFord-Yen"]
 pairs = [
     ("Dijkstra", "BMSSP"),
     ("Dijkstra", "BellmanFord"),
-    ("BMSSP", "BellmanFord")
+    ("BMSSP", "BellmanFord"),
+    ("Dijkstra", "DeltaStepping"),
+    ("Dijkstra", "BMSSP-Duan"),
+    ("BMSSP", "BMSSP-Parallel"),
+    ("BellmanFord", "SPFA"),
+    ("BellmanFord", "BellmanFord-Parallel"),
+    ("BellmanFord", "BellmanFord-Yen")
 ]
 
 results = []
@@ -0,0 +1,327 @@
+#ifndef ALT_HPP
+#define ALT_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "dijkstra.hpp"
+#include "priority_queues.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+// =====================================================
+// ALT: A* + landmarks + desigualdad triangular
+//
+// Preprocesamiento: se eligen K landmarks y, con el
+// Dijkstra de siempre, se guardan d(L, v) (grafo) y
+// d(v, L) (grafo traspuesto) para todo v. En la consulta
+// hacia t, la cota inferior
+//     pi(v) = max_L { d(L, t) - d(L, v), d(v, L) - d(t, L), 0 }
+// es un potencial consistente y se usa como clave
+// dist(v) + pi(v) en la cola (A*).
+// =====================================================
+enum class LandmarkSelection {
+    Farthest,   // el vértice más lejano a los landmarks ya elegidos
+    Avoid       // heurística "avoid" (Goldberg y Werneck)
+};
+
+inline const char* landmark_selection_name(LandmarkSelection sel) {
+    switch (sel) {
+        case LandmarkSelection::Farthest: return "farthest";
+        case LandmarkSelection::Avoid:    return "avoid";
+    }
+    return "?";
+}
+
+// Queue: política de cola (las de buckets no sirven, ver static_assert)
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
+class ALTDijkstra {
+    static_assert(!Queue<T>::uses_max_weight,
+                  "ALT: las claves con potencial no están acotadas por el peso máximo");
+
+public:
+    using graph_type = G;
+    using distance_type = T;
+    using queue_type = Queue<T>;
+
+private:
+    int n;  // número de vértices
+    std::shared_ptr<const G> graph;  // grafo CSR compartido (solo lectura)
+    std::shared_ptr<const G> rev;    // traspuesto (tablas hacia los landmarks)
+
+    std::vector<int> landmarks;
+    // Tablas vértice-mayor: from[v * K + i] = d(L_i, v), to[v * K + i] = d(v, L_i)
+    std::vector<T> from, to;
+
+    std::vector<T> dist;
+    std::vector<T> pot;   // potencial por vértice (INF = aún no calculado)
+    std::vector<int> pred;
+    Queue<T> pq;
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    // Agregar el landmark L y sus dos columnas en las tablas
+    void add_landmark(int L, const std::vector<T>& d_from, const std::vector<T>& d_to) {
+        int K = landmarks.size() + 1;
+        std::vector<T> f((std::size_t)n * K), b((std::size_t)n * K);
+        for (int v = 0; v < n; ++v) {
+            std::copy_n(from.begin() + (std::size_t)v * (K - 1), K - 1,
+                        f.begin() + (std::size_t)v * K);
+            std::copy_n(to.begin() + (std::size_t)v * (K - 1), K - 1,
+                        b.begin() + (std::size_t)v * K);
+            f[(std::size_t)v * K + K - 1] = d_from[v];
+            b[(std::size_t)v * K + K - 1] = d_to[v];
+        }
+        from.swap(f);
+        to.swap(b);
+        landmarks.push_back(L);
+    }
+
+    // Cota inferior de d(s, t) con los landmarks ya elegidos
+    T lower_bound(int s, int t) const {
+        int K = landmarks.size();
+        const T* fs = from.data() + (std::size_t)s * K;
+        const T* ft = from.data() + (std::size_t)t * K;
+        const T* bs = to.data() + (std::size_t)s * K;
+        const T* bt = to.data() + (std::size_t)t * K;
+
+        T best = 0;
+        for (int i = 0; i < K; ++i) {
+            if (fs[i] != INF && ft[i] != INF && ft[i] - fs[i] > best) best = ft[i] - fs[i];
+            if (bs[i] != INF && bt[i] != INF && bs[i] - bt[i] > best) best = bs[i] - bt[i];
+        }
+        return best;
+    }
+
+    // Farthest: el vértice alcanzado más lejano (mínimo sobre los
+    // landmarks elegidos); sin candidatos, el de mayor grado libre
+    int pick_farthest(const std::vector<T>& min_dist) const {
+        int best = -1;
+        for (int v = 0; v < n; ++v) {
+            if (min_dist[v] == INF || min_dist[v] == 0) continue;
+            if (best < 0 || min_dist[v] > min_dist[best]) best = v;
+        }
+        return best >= 0 ? best : pick_free();
+    }
+
+    int pick_free() const {
+        int best = -1;
+        for (int v = 0; v < n; ++v) {
+            if (std::find(landmarks.begin(), landmarks.end(), v) != landmarks.end()) continue;
+            if (best < 0 || graph->degree(v) > graph->degree(best)) best = v;
+        }
+        return best;
+    }
+
+    // Avoid: en el árbol de caminos mínimos desde una raíz r, cada
+    // vértice pesa d(r, v) - cota(r, v); los subárboles que contienen
+    // un landmark valen 0. Se desciende desde la raíz por el hijo de
+    // mayor tamaño hasta una hoja, que pasa a ser el landmark.
+    int pick_avoid(int root, const std::vector<T>& d_root,
+                   const std::vector<int>& p_root) const {
+        // Hijos del árbol (CSR) y orden BFS desde la raíz
+        std::vector<int> start(n + 1, 0), child(n);
+        for (int v = 0; v < n; ++v) {
+            if (p_root[v] >= 0) start[p_root[v] + 1]++;
+        }
+        for (int v = 0; v < n; ++v) start[v + 1] += start[v];
+        std::vector<int> cursor(start.begin(), start.end() - 1);
+        for (int v = 0; v < n; ++v) {
+            if (p_root[v] >= 0) child[cursor[p_root[v]]++] = v;
+        }
+
+        std::vector<int> order{root};
+        for (std::size_t h = 0; h < order.size(); ++h) {
+            int u = order[h];
+            for (int c = start[u]; c < start[u + 1]; ++c) order.push_back(child[c]);
+        }
+
+        std::vector<char> is_landmark(n, 0);
+        for (int L : landmarks) is_landmark[L] = 1;
+
+        std::vector<T> size(n, 0);
+        std::vector<char> blocked(n, 0);
+        for (int h = (int)order.size() - 1; h >= 0; --h) {
+            int v = order[h];
+            blocked[v] |= is_landmark[v];
+            if (!blocked[v]) size[v] += d_root[v] - lower_bound(root, v);
+            if (p_root[v] >= 0) {
+                blocked[p_root[v]] |= blocked[v];
+                size[p_root[v]] += blocked[v] ? 0 : size[v];
+            }
+        }
+
+        // Descenso por el hijo de mayor tamaño
+        int v = root;
+        while (true) {
+            int next = -1;
+            for (int c = start[v]; c < start[v + 1]; ++c) {
+                int w = child[c];
+                if (blocked[w]) continue;
+                if (next < 0 || size[w] > size[next]) next = w;
+            }
+            if (next < 0) break;
+            v = next;
+        }
+        return (v == root && is_landmark[v]) ? pick_free() : v;
+    }
+
+public:
+    ALTDijkstra(std::shared_ptr<const G> g, int K = 8,
+                LandmarkSelection sel = LandmarkSelection::Farthest,
+                unsigned seed = 42)
+        : n(g->get_vertices()), graph(std::move(g)),
+          rev(std::make_shared<const G>(graph->reversed())) {
+        preprocess(std::min(K, n), sel, seed);
+    }
+
+    // Elegir landmarks y llenar las tablas con Dijkstra
+    void preprocess(int K, LandmarkSelection sel, unsigned seed = 42) {
+        landmarks.clear();
+        from.clear();
+        to.clear();
+        if (n == 0) return;
+
+        Dijkstra<T, G, Queue> fwd(graph), bwd(rev);
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> pick(0, n - 1);
+        std::vector<T> min_dist(n, INF);
+
+        // Farthest arranca desde el más lejano a un vértice al azar
+        int next = -1;
+        if (sel == LandmarkSelection::Farthest) {
+            next = pick_farthest(fwd.execute(pick(rng)).first);
+        }
+
+        for (int i = 0; i < K; ++i) {
+            if (sel == LandmarkSelection::Avoid) {
+                int root = pick(rng);
+                auto [d_root, p_root] = fwd.execute(root);
+                next = pick_avoid(root, d_root, p_root);
+            }
+            if (next < 0) break;
+
+            auto d_from = fwd.execute(next).first;
+            auto d_to = bwd.execute(next).first;
+            add_landmark(next, d_from, d_to);
+
+            if (sel == LandmarkSelection::Farthest) {
+                for (int v = 0; v < n; ++v) {
+                    min_dist[v] = std::min(min_dist[v], d_from[v]);
+                }
+                next = pick_farthest(min_dist);
+            }
+        }
+    }
+
+    // Distancia más corta de source a target con A* (INF si no hay camino)
+    T query(int source, int target, Metrics* M = nullptr) {
+        if (source < 0 || source >= n || target < 0 || target >= n) {
+            return INF;
+        }
+
+        const G& g = *graph;
+        pq.init(n);
+        dist.assign(n, INF);
+        pot.assign(n, INF);
+        pred.assign(n, -1);
+        if (M) M->assign(3 * n);
+
+        auto potential = [&](int v) {
+            if (pot[v] == INF) pot[v] = lower_bound(v, target);
+            return pot[v];
+        };
+
+        dist[source] = 0;
+        pq.push(source, potential(source));
+        if (M) {
+            M->assign(2);
+            M->call(2);
+        }
+
+        while (!pq.empty()) {
+            if (M) M->compare();
+
+            auto [key, u] = pq.pop();
+            if (M) {
+                M->call(2);
+                M->assign(2);
+            }
+
+            if (key > dist[u] + pot[u]) {
+                if (M) {
+                    M->compare();
+                    M->arithmetic();
+                    M->access(2);
+                }
+                continue;
+            }
+            if (M) M->settle();
+
+            if (u == target) break;
+
+            for (auto e = g.edge_begin(u); e < g.edge_end(u); ++e) {
+                if (M) M->access(2);
+
+                int v = g.target(e);
+                T new_dist = dist[u] + static_cast<T>(g.weight(e));
+                if (M) {
+                    M->assign(2);
+                    M->arithmetic();
+                    M->access();
+                }
+
+                if (new_dist < dist[v]) {
+                    if (M) {
+                        M->compare();
+                        M->assign(2);
+                        M->access(2);
+                        M->arithmetic(2 * landmarks.size());   // potencial
+                    }
+
+                    dist[v] = new_dist;
+                    pred[v] = u;
+                    pq.push(v, new_dist + potential(v));
+                    if (M) M->call(2);
+                }
+            }
+        }
+
+        return dist[target];
+    }
+
+    // Camino hasta el destino de la última consulta
+    std::vector<int> get_shortest_path(int destination) const {
+        if (destination < 0 || destination >= n || pred.empty() ||
+            dist[destination] == INF) {
+            return {};
+        }
+
+        std::vector<int> path;
+        for (int x = destination; x != -1; x = pred[x]) {
+            path.push_back(x);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    const std::vector<int>& get_landmarks() const { return landmarks; }
+    T get_lower_bound(int s, int t) const { return lower_bound(s, t); }
+
+    // Bytes de las tablas de distancias
+    std::size_t table_bytes() const { return (from.size() + to.size()) * sizeof(T); }
+
+    // Nombre de la cola de prioridad usada
+    static const char* queue_name() { return Queue<T>::name(); }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // ALT_HPP
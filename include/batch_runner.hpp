@@ -0,0 +1,145 @@
+#ifndef BATCH_RUNNER_HPP
+#define BATCH_RUNNER_HPP
+
+#include "workspace.hpp"
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+
+// =====================================================
+// Ejecución de SSSP en lote sobre muchas fuentes
+//
+// Todos los hilos comparten el mismo grafo CSR (solo
+// lectura); cada uno tiene su propio motor (Dijkstra,
+// bmssp, BellmanFord: cualquiera con execute(source, ws))
+// y su propio SSSPWorkspace.
+//
+// Las fuentes se reparten en bloques contiguos, uno por
+// hilo. Cada hilo consume su deque por el frente y, al
+// vaciarla, roba de la cola de otro hilo (work stealing),
+// así los hilos con fuentes baratas ayudan a los demás.
+//
+// El callback recibe (source, workspace, thread_id) y se
+// llama desde los hilos de trabajo: debe ser seguro para
+// llamadas concurrentes. El workspace solo es válido
+// durante la llamada.
+// =====================================================
+template<typename Engine>
+class BatchRunner {
+public:
+    using T = typename Engine::distance_type;
+    using Graph = typename Engine::graph_type;
+
+    // Estadísticas de la última corrida
+    struct Stats {
+        int threads = 0;
+        std::size_t sources = 0;
+        double elapsed_ms = 0.0;
+        std::vector<std::size_t> per_thread;   // fuentes resueltas por hilo
+        std::size_t steals = 0;
+
+        double queries_per_second() const {
+            return elapsed_ms > 0.0 ? sources / (elapsed_ms / 1000.0) : 0.0;
+        }
+    };
+
+private:
+    std::shared_ptr<const Graph> graph;
+    int threads;
+    Stats stats;
+
+    // Cola de trabajo de un hilo (índices en el arreglo de fuentes)
+    struct WorkQueue {
+        std::mutex lock;
+        std::deque<std::size_t> items;
+    };
+
+    static bool take_front(WorkQueue& q, std::size_t& item) {
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.items.empty()) return false;
+        item = q.items.front();
+        q.items.pop_front();
+        return true;
+    }
+
+    static bool take_back(WorkQueue& q, std::size_t& item) {
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.items.empty()) return false;
+        item = q.items.back();
+        q.items.pop_back();
+        return true;
+    }
+
+public:
+    // threads = 0: std::thread::hardware_concurrency()
+    explicit BatchRunner(std::shared_ptr<const Graph> g, int num_threads = 0)
+        : graph(std::move(g)), threads(num_threads) {
+        if (threads <= 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+    }
+
+    template<typename Callback>
+    const Stats& run(const std::vector<int>& sources, Callback&& callback) {
+        int used = std::max(1, std::min<int>(threads, (int)sources.size()));
+
+        std::vector<WorkQueue> queues(used);
+        std::size_t block = (sources.size() + used - 1) / used;
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            queues[i / block].items.push_back(i);
+        }
+
+        stats = Stats();
+        stats.threads = used;
+        stats.sources = sources.size();
+        stats.per_thread.assign(used, 0);
+        std::vector<std::size_t> steals(used, 0);
+
+        auto worker = [&](int id) {
+            Engine engine(graph);
+            SSSPWorkspace<T> ws;
+
+            std::size_t item;
+            while (true) {
+                bool found = take_front(queues[id], item);
+                for (int k = 1; !found && k < used; ++k) {
+                    found = take_back(queues[(id + k) % used], item);
+                    if (found) steals[id]++;
+                }
+                if (!found) break;   // todas las colas vacías (no se agrega trabajo)
+
+                engine.execute(sources[item], ws);
+                callback(sources[item], static_cast<const SSSPWorkspace<T>&>(ws), id);
+                stats.per_thread[id]++;
+            }
+        };
+
+        auto start = std::chrono::high_resolution_clock::now();
+        if (used == 1) {
+            worker(0);
+        }
+        else {
+            std::vector<std::thread> pool;
+            for (int id = 0; id < used; ++id) {
+                pool.emplace_back(worker, id);
+            }
+            for (auto& th : pool) th.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        stats.elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        for (std::size_t s : steals) stats.steals += s;
+        return stats;
+    }
+
+    // Getters
+    int get_threads() const { return threads; }
+    const Stats& get_stats() const { return stats; }
+};
+
+#endif // BATCH_RUNNER_HPP
@@ -2,35 +2,150 @@
 #define BELLMAN_FORD_HPP
 
 #include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "workspace.hpp"
+#include "vertex_ordering.hpp"
 
 #include <vector>
 #include <limits>
 #include <algorithm>
+#include <memory>
 
-template<typename T>
+// Orden en que se relajan las aristas en cada ronda
+enum class BellmanFordOrder {
+    Csr,   // orden del CSR (por vértice origen)
+    Yen    // mejora de Yen: pasada hacia adelante y hacia atrás
+};
+
+// =====================================================
+// Mejora de Yen
+//
+// Con un orden de vértices fijo, las aristas se separan en
+// hacia adelante (rank[u] < rank[v]) y hacia atrás. Cada
+// ronda recorre los vértices en orden creciente relajando
+// las hacia adelante y después en orden decreciente
+// relajando las hacia atrás; como las distancias se
+// actualizan en el lugar, una ronda propaga cualquier
+// camino que alterne a lo sumo una vez de dirección, y el
+// total de rondas baja de V - 1 a ceil(V / 2).
+//
+// El orden es el BFS desde la fuente (las aristas del
+// árbol BFS quedan todas hacia adelante). Se arma en
+// prepare_yen(source), o en execute si cambia la fuente:
+// dos CSR renumerados por rango, uno por dirección.
+//
+// Ciclos negativos (desarme de subárboles de Tarjan): el
+// árbol de predecesores se mantiene en preorden (lista
+// doble + profundidad). Al mejorar v desde u se desarma el
+// subárbol de v, cuyas distancias quedaron viejas: sus
+// vértices no se relajan hasta volver a mejorar. Si u está
+// en ese subárbol, la arista (u, v) cierra un ciclo
+// negativo y la búsqueda se detiene en ese momento, sin
+// esperar a la ronda V. Como el árbol nunca tiene ciclos,
+// las rondas terminan aunque no haya tope de V - 1.
+// =====================================================
+template<typename T, typename G = CSRGraph<T>>
 class BellmanFord {
+public:
+    using graph_type = G;
+    using distance_type = T;
+
 private:
-    struct Edge {
-        int from;
-        int to;
-        T weight;
-        Edge(int f, int t, T w) : from(f), to(t), weight(w) {}
-    };
-    
+    using Ordering = VertexReordering<typename G::weight_type,
+                                      typename G::vertex_type,
+                                      typename G::edge_type>;
+
     int n;  // número de vértices
-    std::vector<Edge> edges;  // lista de aristas
-    std::vector<T> dist;
-    std::vector<int> pred;
-    
+    CSRGraphBuilder<G> graph;  // grafo CSR compartido (solo lectura)
+    SSSPWorkspace<T> own;      // workspace de execute(source)
+    BellmanFordOrder order;
+
+    // Preproceso de Yen (IDs por rango en el orden BFS)
+    int yen_root = -1;
+    std::vector<int> yen_order;   // yen_order[rango] = vértice
+    G forward, backward;
+    std::vector<T> rank_dist;
+    std::vector<int> rank_pred;
+
+    // Árbol de predecesores en preorden (IDs del recorrido: vértices
+    // o rangos). depth < 0: fuera del árbol (no alcanzado o desarmado)
+    std::vector<int> thread_next, thread_prev, depth;
+    std::vector<int> negative_cycle;  // vértices del último ciclo hallado
+
     static constexpr T INF = std::numeric_limits<T>::max();
 
+    void init() {
+        thread_next.assign(n, -1);
+        thread_prev.assign(n, -1);
+        depth.assign(n, -1);
+    }
+
+    // El árbol queda con la raíz sola
+    void tree_reset(int root, Metrics* M) {
+        std::fill(depth.begin(), depth.end(), -1);
+        depth[root] = 0;
+        thread_next[root] = thread_prev[root] = root;
+        if (M) M->assign(n + 3);
+    }
+
+    // Desarma el subárbol de v y lo cuelga de u como hoja. Si u
+    // estaba en ese subárbol, guarda el ciclo (v, ..., u) siguiendo
+    // pred desde u y devuelve false
+    bool tree_attach(int u, int v, const std::vector<int>& pred, Metrics* M) {
+        int dv = depth[v];
+        if (dv >= 0) {
+            int before = thread_prev[v];
+            int x = v;
+            do {
+                if (x == u) {
+                    negative_cycle.clear();
+                    for (int y = u; y != v; y = pred[y]) {
+                        negative_cycle.push_back(y);
+                    }
+                    negative_cycle.push_back(v);
+                    std::reverse(negative_cycle.begin(), negative_cycle.end());
+                    return false;
+                }
+                int following = thread_next[x];
+                depth[x] = -1;
+                x = following;
+                if (M) {
+                    M->access(2);
+                    M->compare(2);
+                }
+            } while (depth[x] > dv);
+
+            thread_next[before] = x;
+            thread_prev[x] = before;
+        }
+
+        int after = thread_next[u];
+        depth[v] = depth[u] + 1;
+        thread_next[u] = v;
+        thread_prev[v] = u;
+        thread_next[v] = after;
+        thread_prev[after] = v;
+        if (M) M->assign(6);
+        return true;
+    }
+
 public:
-    BellmanFord(int vertices) : n(vertices) {}
+    BellmanFord(int vertices, BellmanFordOrder edge_order = BellmanFordOrder::Csr)
+        : n(vertices), graph(vertices), order(edge_order) {
+        init();
+    }
+
+    // Usar un grafo CSR ya construido, compartido con otros algoritmos
+    BellmanFord(std::shared_ptr<const G> g, BellmanFordOrder edge_order = BellmanFordOrder::Csr)
+        : n(g->get_vertices()), graph(std::move(g)), order(edge_order) {
+        init();
+    }
     
     // Agregar arista dirigida
     void add_edge(int u, int v, T weight) {
         if (u >= 0 && u < n && v >= 0 && v < n) {
-            edges.emplace_back(u, v, weight);
+            graph.add_edge(u, v, weight);
+            yen_root = -1;
         }
     }
     
@@ -40,47 +155,135 @@ public:
             return {{}, {}};
         }
 
-        dist.assign(n, INF);
-        pred.assign(n, -1);
-        if (M) M->assign(2 * n);   // inicialización de vectores
+        execute(source, own, M);
+        return {own.dist, own.pred};
+    }
+
+    // Preproceso de Yen para una fuente: orden BFS desde source y
+    // aristas separadas por dirección
+    void prepare_yen(int source) {
+        if (source < 0 || source >= n || source == yen_root) {
+            return;
+        }
+
+        const G& g = graph.get();
+        yen_order = Ordering::bfs_order(g, source);
+        std::vector<int> rank(n);
+        for (int i = 0; i < n; ++i) {
+            rank[yen_order[i]] = i;
+        }
+
+        // Un CSR por dirección, con vértices y destinos por rango
+        using EId = typename G::edge_type;
+        using VId = typename G::vertex_type;
+        using W = typename G::weight_type;
+        std::vector<EId> fwd_offsets(n + 1, 0), bwd_offsets(n + 1, 0);
+        for (int i = 0; i < n; ++i) {
+            int u = yen_order[i];
+            EId ahead = 0;
+            for (EId e = g.edge_begin(u); e < g.edge_end(u); ++e) {
+                if (rank[g.target(e)] > i) ahead++;
+            }
+            fwd_offsets[i + 1] = fwd_offsets[i] + ahead;
+            bwd_offsets[i + 1] = bwd_offsets[i] + (g.degree(u) - ahead);
+        }
+
+        std::vector<VId> fwd_targets(fwd_offsets[n]), bwd_targets(bwd_offsets[n]);
+        std::vector<W> fwd_weights(fwd_offsets[n]), bwd_weights(bwd_offsets[n]);
+        for (int i = 0; i < n; ++i) {
+            int u = yen_order[i];
+            EId f = fwd_offsets[i], b = bwd_offsets[i];
+            for (EId e = g.edge_begin(u); e < g.edge_end(u); ++e) {
+                int j = rank[g.target(e)];
+                if (j > i) {
+                    fwd_targets[f] = static_cast<VId>(j);
+                    fwd_weights[f++] = g.weight(e);
+                }
+                else {
+                    bwd_targets[b] = static_cast<VId>(j);
+                    bwd_weights[b++] = g.weight(e);
+                }
+            }
+        }
+
+        forward = G::from_arrays(n, std::move(fwd_offsets),
+                                 std::move(fwd_targets), std::move(fwd_weights));
+        backward = G::from_arrays(n, std::move(bwd_offsets),
+                                  std::move(bwd_targets), std::move(bwd_weights));
+        rank_dist.assign(n, INF);
+        rank_pred.assign(n, -1);
+        yen_root = source;
+    }
+
+    // Igual que execute, pero sobre un workspace del llamador: no hay
+    // copia de resultados (leerlos con ws.distances()/predecessors())
+    void execute(int source, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return;
+        }
+
+        negative_cycle.clear();
+        if (order == BellmanFordOrder::Yen) {
+            execute_yen(source, ws, M);
+            return;
+        }
+
+        const G& g = graph.get();
+
+        // Reinicio O(tocados) salvo la primera vez
+        if (M) M->assign(2 * (ws.dist.size() == (std::size_t)n ? ws.touched_count() : n));
+        ws.reset(n, INF);
+        const std::vector<T>& dist = ws.dist;
 
-        dist[source] = 0;
+        ws.update(source, 0, -1);
+        tree_reset(source, M);
         if (M) M->assign();
 
-        // Relajación de aristas: V-1 iteraciones
-        for (int i = 0; i < n - 1; ++i) {
-            if (M) M->compare();
+        // Rondas hasta que ninguna arista mejore (a lo sumo V - 1
+        // sin ciclos negativos) o hasta cerrar un ciclo en el árbol
+        while (true) {
+            if (M) {
+                M->compare();
+                M->round();
+            }
             
             bool relaxed = false;
             if (M) M->assign();
             
-            for (const auto& edge : edges) {
-                if (M) {
-                    M->access(3);  // edge.from, edge.to, edge.weight
+            // Las aristas se recorren agrupadas por origen (CSR)
+            for (int u = 0; u < n; ++u) {
+                if (M) M->access();
+
+                // Solo relajar si el vértice origen está en el árbol
+                // (alcanzado y con distancia vigente)
+                if (depth[u] < 0) {
+                    if (M) M->compare();
+                    continue;
                 }
-                
-                // Solo relajar si el vértice origen ya tiene distancia conocida
-                if (dist[edge.from] != INF) {
+
+                for (auto e = g.edge_begin(u); e < g.edge_end(u); ++e) {
                     if (M) {
-                        M->compare();
-                        M->access();
+                        M->access(2);  // target, weight
                     }
-                    
-                    T new_dist = dist[edge.from] + edge.weight;
+
+                    int v = g.target(e);
+                    T new_dist = dist[u] + static_cast<T>(g.weight(e));
                     if (M) {
                         M->arithmetic();
-                        M->assign();
+                        M->assign(2);
                     }
                     
-                    if (new_dist < dist[edge.to]) {
+                    if (new_dist < dist[v]) {
                         if (M) {
                             M->compare();
                             M->access(2);
                             M->assign(2);
                         }
                         
-                        dist[edge.to] = new_dist;
-                        pred[edge.to] = edge.from;
+                        if (!tree_attach(u, v, ws.pred, M)) {
+                            return;  // ciclo negativo
+                        }
+                        ws.update(v, new_dist, u);
                         relaxed = true;
                     }
                 }
@@ -92,17 +295,103 @@ public:
                 break;
             }
         }
+    }
+
+private:
+    // =====================================================
+    // Rondas de Yen sobre los CSR por dirección (IDs por
+    // rango); al final se copia al workspace con los IDs
+    // originales
+    // =====================================================
+    void execute_yen(int source, SSSPWorkspace<T>& ws, Metrics* M) {
+        prepare_yen(source);
 
-        return {dist, pred};
+        // La fuente tiene rango 0; el resto queda en INF
+        std::fill(rank_dist.begin(), rank_dist.end(), INF);
+        std::fill(rank_pred.begin(), rank_pred.end(), -1);
+        rank_dist[0] = 0;
+        tree_reset(0, M);
+        if (M) M->assign(2 * n + 1);
+
+        // Relaja las aristas de i en h; true si alguna mejoró. Al
+        // cerrar un ciclo negativo, cycle queda en true
+        bool cycle = false;
+        auto relax = [&](const G& h, int i) {
+            bool relaxed = false;
+            T di = rank_dist[i];
+            for (auto e = h.edge_begin(i); e < h.edge_end(i); ++e) {
+                int j = h.target(e);
+                T new_dist = di + static_cast<T>(h.weight(e));
+                if (M) {
+                    M->access(2);
+                    M->arithmetic();
+                    M->assign(2);
+                }
+
+                if (new_dist < rank_dist[j]) {
+                    if (M) {
+                        M->compare();
+                        M->assign(2);
+                    }
+                    if (!tree_attach(i, j, rank_pred, M)) {
+                        cycle = true;
+                        return false;
+                    }
+                    rank_dist[j] = new_dist;
+                    rank_pred[j] = i;
+                    relaxed = true;
+                }
+            }
+            return relaxed;
+        };
+
+        // Sin ciclos negativos alcanza con ceil(V / 2) rondas
+        while (true) {
+            if (M) {
+                M->compare();
+                M->round();
+            }
+
+            bool relaxed = false;
+            for (int i = 0; i < n && !cycle; ++i) {
+                if (depth[i] >= 0) relaxed |= relax(forward, i);
+            }
+            for (int i = n - 1; i >= 0 && !cycle; --i) {
+                if (depth[i] >= 0) relaxed |= relax(backward, i);
+            }
+            if (M) M->access(2 * n);
+
+            // Ciclo negativo: se traduce a los IDs originales
+            if (cycle) {
+                for (int& c : negative_cycle) c = yen_order[c];
+                break;
+            }
+
+            if (!relaxed) {
+                if (M) M->compare();
+                break;
+            }
+        }
+
+        // Copiar al workspace con los IDs originales
+        if (M) M->assign(2 * (ws.dist.size() == (std::size_t)n ? ws.touched_count() : n));
+        ws.reset(n, INF);
+        for (int i = 0; i < n; ++i) {
+            if (rank_dist[i] == INF) continue;
+            int p = rank_pred[i];
+            ws.update(yen_order[i], rank_dist[i], p < 0 ? -1 : yen_order[p]);
+        }
     }
+
+public:
     
     // Reconstruir el camino más corto hasta un destino
     std::vector<int> get_shortest_path(int destination) const {
-        if (destination < 0 || destination >= n || pred.empty()) {
+        if (destination < 0 || destination >= n || own.pred.empty()) {
             return {};
         }
         
-        if (dist[destination] == INF) {
+        if (own.dist[destination] == INF) {
             return {};  // No hay camino
         }
         
@@ -111,7 +400,7 @@ public:
         
         while (current != -1) {
             path.push_back(current);
-            current = pred[current];
+            current = own.pred[current];
         }
         
         std::reverse(path.begin(), path.end());
@@ -121,50 +410,40 @@ public:
     // Verificar si hay camino a un destino
     bool has_path(int destination) const {
         return destination >= 0 && destination < n && 
-               !dist.empty() && dist[destination] != INF;
+               !own.dist.empty() && own.dist[destination] != INF;
     }
     
     // Obtener distancia a un destino
     T get_distance(int destination) const {
-        if (destination >= 0 && destination < n && !dist.empty()) {
-            return dist[destination];
+        if (destination >= 0 && destination < n && !own.dist.empty()) {
+            return own.dist[destination];
         }
         return INF;
     }
     
-    // Detectar ciclos negativos alcanzables desde source
-    bool has_negative_cycle(int source) const {
-        if (source < 0 || source >= n || dist.empty()) {
-            return false;
-        }
-        
-        // Ejecutar una iteración adicional
-        std::vector<T> test_dist = dist;
-        
-        for (const auto& edge : edges) {
-            if (test_dist[edge.from] != INF) {
-                T new_dist = test_dist[edge.from] + edge.weight;
-                if (new_dist < test_dist[edge.to]) {
-                    return true;  // Ciclo negativo detectado
-                }
-            }
-        }
-        
-        return false;
-    }
+    // Hubo un ciclo negativo alcanzable en la última ejecución
+    // (las distancias de esa ejecución no son válidas)
+    bool has_negative_cycle() const { return !negative_cycle.empty(); }
+
+    // Vértices del ciclo en orden de recorrido: cada uno es el
+    // predecesor del siguiente y el último cierra con el primero
+    // (vacío si no hubo)
+    const std::vector<int>& get_negative_cycle() const { return negative_cycle; }
     
     // Limpiar el grafo
     void clear() {
-        edges.clear();
-        dist.clear();
-        pred.clear();
+        graph.clear();
+        own = SSSPWorkspace<T>();
+        yen_root = -1;
     }
     
     // Getters
     int get_vertices() const { return n; }
-    int get_edges_count() const { return edges.size(); }
-    const std::vector<T>& get_distances() const { return dist; }
-    const std::vector<int>& get_predecessors() const { return pred; }
+    BellmanFordOrder get_order() const { return order; }
+    int get_edges_count() const { return (int)graph.edge_count(); }
+    std::shared_ptr<const G> get_graph() { return graph.shared(); }
+    const std::vector<T>& get_distances() const { return own.dist; }
+    const std::vector<int>& get_predecessors() const { return own.pred; }
     
     // Valor infinito público para comparaciones
     static T infinity() { return INF; }
@@ -0,0 +1,226 @@
+#ifndef BIDIRECTIONAL_DIJKSTRA_HPP
+#define BIDIRECTIONAL_DIJKSTRA_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "priority_queues.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <memory>
+
+// =====================================================
+// Dijkstra bidireccional para consultas punto a punto
+//
+// Búsqueda hacia adelante desde source sobre el grafo y
+// hacia atrás desde target sobre el grafo traspuesto
+// (CSRGraph::reversed). En cada paso avanza el lado con
+// la cola más chica. mu es el mejor camino s-t visto al
+// escanear aristas que tocan el otro lado; se termina
+// cuando la suma de las últimas claves extraídas de cada
+// cola (cotas inferiores de lo pendiente) alcanza mu.
+// =====================================================
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
+class BidirectionalDijkstra {
+public:
+    using graph_type = G;
+    using distance_type = T;
+    using queue_type = Queue<T>;
+
+private:
+    int n;  // número de vértices
+    CSRGraphBuilder<G> graph;       // grafo CSR compartido (solo lectura)
+    std::shared_ptr<const G> rev;   // traspuesto (se construye una vez)
+
+    std::vector<T> dist_f, dist_b;
+    std::vector<int> pred_f;   // predecesor hacia source
+    std::vector<int> succ_b;   // sucesor hacia target
+    Queue<T> pq_f, pq_b;
+    bool queue_ready = false;
+
+    int source = -1, target = -1;
+    int meet_u = -1, meet_v = -1;  // arista (meet_u, meet_v) del mejor camino
+    T mu;
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    // Extraer de un lado y escanear sus aristas (h es el grafo
+    // o el traspuesto). Devuelve la clave extraída.
+    T step(const G& h, Queue<T>& pq, std::vector<T>& dist, std::vector<int>& link,
+           const std::vector<T>& other, bool forward, Metrics* M) {
+        auto [d, u] = pq.pop();
+        if (M) {
+            M->call(2);
+            M->assign(2);
+        }
+
+        if (d > dist[u]) {
+            if (M) {
+                M->compare();
+                M->access();
+            }
+            return d;
+        }
+        if (M) M->settle();
+
+        for (auto e = h.edge_begin(u); e < h.edge_end(u); ++e) {
+            if (M) M->access(2);
+
+            int v = h.target(e);
+            T new_dist = d + static_cast<T>(h.weight(e));
+            if (M) {
+                M->assign(2);
+                M->arithmetic();
+            }
+
+            if (new_dist < dist[v]) {
+                if (M) {
+                    M->compare();
+                    M->assign(2);
+                    M->access(2);
+                }
+                dist[v] = new_dist;
+                link[v] = u;
+                pq.push(v, new_dist);
+                if (M) M->call();
+            }
+
+            // Camino candidato que cruza la arista escaneada
+            if (other[v] != INF && new_dist + other[v] < mu) {
+                if (M) {
+                    M->compare(2);
+                    M->arithmetic();
+                    M->assign(3);
+                }
+                mu = new_dist + other[v];
+                meet_u = forward ? u : v;
+                meet_v = forward ? v : u;
+            }
+        }
+        return d;
+    }
+
+public:
+    BidirectionalDijkstra(int vertices) : n(vertices), graph(vertices), mu(INF) {}
+
+    // Usar un grafo CSR ya construido, compartido con otros algoritmos
+    BidirectionalDijkstra(std::shared_ptr<const G> g)
+        : n(g->get_vertices()), graph(std::move(g)), mu(INF) {}
+
+    // Agregar arista dirigida
+    void add_edge(int u, int v, T weight) {
+        if (u >= 0 && u < n && v >= 0 && v < n) {
+            graph.add_edge(u, v, weight);
+            rev.reset();
+            queue_ready = false;
+        }
+    }
+
+    // Distancia más corta de s a t (INF si no hay camino)
+    T query(int s, int t, Metrics* M = nullptr) {
+        source = s;
+        target = t;
+        meet_u = meet_v = -1;
+        mu = INF;
+        if (s < 0 || s >= n || t < 0 || t >= n) {
+            source = target = -1;
+            return INF;
+        }
+
+        const G& g = graph.get();
+        if (!rev) {
+            rev = std::make_shared<const G>(g.reversed());
+        }
+        if (!queue_ready) {
+            T max_w = Queue<T>::uses_max_weight
+                          ? static_cast<T>(g.weight_range().second) : T();
+            pq_f.init(n, max_w);
+            pq_b.init(n, max_w);
+            queue_ready = true;
+        }
+
+        dist_f.assign(n, INF);
+        dist_b.assign(n, INF);
+        pred_f.assign(n, -1);
+        succ_b.assign(n, -1);
+        if (M) M->assign(4 * n);
+
+        if (s == t) {
+            dist_f[s] = dist_b[t] = 0;
+            mu = 0;
+            return mu;
+        }
+
+        dist_f[s] = 0;
+        dist_b[t] = 0;
+        pq_f.clear();
+        pq_b.clear();
+        pq_f.push(s, 0);
+        pq_b.push(t, 0);
+        if (M) {
+            M->assign(2);
+            M->call(2);
+        }
+
+        T top_f = 0, top_b = 0;  // últimas claves extraídas
+        while (!pq_f.empty() && !pq_b.empty()) {
+            if (M) M->compare(3);
+            if (mu != INF && top_f + top_b >= mu) break;
+
+            if (pq_f.size() <= pq_b.size()) {
+                top_f = step(g, pq_f, dist_f, pred_f, dist_b, true, M);
+            }
+            else {
+                top_b = step(*rev, pq_b, dist_b, succ_b, dist_f, false, M);
+            }
+        }
+
+        return mu;
+    }
+
+    // Camino de la última consulta (vacío si no hay)
+    std::vector<int> get_shortest_path() const {
+        if (source < 0 || mu == INF) {
+            return {};
+        }
+        if (source == target) {
+            return {source};
+        }
+
+        std::vector<int> path;
+        for (int x = meet_u; x != -1; x = pred_f[x]) {
+            path.push_back(x);
+        }
+        std::reverse(path.begin(), path.end());
+        for (int x = meet_v; x != -1; x = succ_b[x]) {
+            path.push_back(x);
+        }
+        return path;
+    }
+
+    // Distancia de la última consulta
+    T get_distance() const { return mu; }
+
+    // Limpiar el grafo
+    void clear() {
+        graph.clear();
+        rev.reset();
+        queue_ready = false;
+        source = target = -1;
+        mu = INF;
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    std::shared_ptr<const G> get_graph() { return graph.shared(); }
+
+    // Nombre de la cola de prioridad usada
+    static const char* queue_name() { return Queue<T>::name(); }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // BIDIRECTIONAL_DIJKSTRA_HPP
@@ -2,86 +2,263 @@
 #define BMSSP_HPP
 
 #include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "priority_queues.hpp"
+#include "workspace.hpp"
+#include "thread_barrier.hpp"
 
 #include <vector>
-#include <queue>
 #include <limits>
 #include <cmath>
 #include <algorithm>
+#include <memory>
+#include <atomic>
+#include <thread>
 
 namespace spp {
 
-template<typename T>
+// =====================================================
+// Parámetros de ajuste de bmssp
+//
+// base_limit:      vértices que asienta cada baseCase
+// quota_factor:    bmsspLevels extrae hasta quota_factor * |S|
+//                  vértices por nivel
+// pivot_threshold: aristas relajables para que un vértice
+//                  de S sea pivote
+// max_depth:       profundidad máxima de la recursión
+//                  (0 = log2(n))
+// threads:         hilos para los subproblemas de cada nivel
+//                  (1 = secuencial, 0 = todos los núcleos)
+//
+// Valores < 1 se llevan a 1. Lo que quede sin asentar lo
+// resuelve la corrección final, así que cualquier
+// combinación da distancias exactas; solo cambia el tiempo
+// =====================================================
+struct bmssp_config {
+    int base_limit = 8;
+    int quota_factor = 4;
+    int pivot_threshold = 2;
+    int max_depth = 0;
+    int threads = 1;
+};
+
+// Queue: política de cola de prioridad (ver priority_queues.hpp)
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
 class bmssp {
 public:
+    using graph_type = G;
+    using distance_type = T;
+    using queue_type = Queue<T>;
+
     static constexpr T INF = std::numeric_limits<T>::max() / 4;
 
 private:
     int n;
-    std::vector<std::vector<std::pair<int,T>>> adj;
-
-    std::vector<T> dist;
-    std::vector<int> pred;
-    std::vector<bool> visited;
-
-    int max_depth;
+    CSRGraphBuilder<G> graph;   // grafo CSR compartido (solo lectura)
+    const G* csr = nullptr;  // grafo de la ejecución actual
+
+    SSSPWorkspace<T> own;            // workspace de execute(source)
+    SSSPWorkspace<T>* ws = nullptr;  // workspace de la ejecución actual
+
+    // Cola compartida por baseCase, bmsspLevels y la corrección
+    // final: cada fase la vacía al comenzar y conserva su capacidad
+    Queue<T> pq;
+
+    // Buffers de los niveles, reservados una vez (n) y reutilizados
+    // entre niveles y entre ejecuciones: con un workspace ya usado,
+    // una consulta no pide memoria salvo que la cola crezca más que
+    // en las anteriores
+    std::vector<int> frontier;   // S del nivel actual
+    std::vector<int> next;       // S del nivel siguiente
+    std::vector<int> pivots;
+
+    // Modo paralelo (config.threads > 1): copia atómica de dist y
+    // visited, igual al workspace fuera de parallelLevel
+    struct Relaxation { int v; T d; int u; };
+    struct Worker {
+        Queue<T> pq;                      // cola propia del hilo
+        std::vector<Relaxation> relaxed;  // mejoras hechas por el hilo
+        std::vector<int> found;           // vértices que extrajo
+        T bound;                          // cota de su intervalo
+        long long relaxations = 0;
+    };
+    std::unique_ptr<std::atomic<T>[]> shared_dist;
+    std::unique_ptr<std::atomic<char>[]> shared_done;
+    std::vector<Worker> workers;
+    std::vector<int> mark;   // mark[v] == epoch: v ya está en next
+    int epoch = 0;
+
+    // Equipo de hilos creado una vez en init y reutilizado entre
+    // niveles y consultas: cada nivel abre con start y cierra con
+    // finish, así parallelLevel no crea hilos ni pide memoria
+    std::vector<std::thread> team;
+    std::unique_ptr<ThreadBarrier> start, finish;
+    int groups = 0;   // grupos del nivel actual (hilos con trabajo)
+    int share = 0;    // vértices que extrae cada grupo
+    bool stop = false;
+
+    bmssp_config config;
     Metrics* M;   // contador de instrucciones
 
 public:
-    bmssp(int n_, Metrics* metrics = nullptr)
-        : n(n_), M(metrics)
+    bmssp(int n_, Metrics* metrics = nullptr, const bmssp_config& cfg = bmssp_config())
+        : n(n_), graph(n_), config(cfg), M(metrics)
     {
-        adj.assign(n, {});
-        dist.assign(n, INF);
-        pred.assign(n, -1);
-        visited.assign(n, false);
+        init();
+    }
 
-        if (M) M->assign(4 * n);
+    // Usar un grafo CSR ya construido, compartido con otros algoritmos
+    bmssp(std::shared_ptr<const G> g, Metrics* metrics = nullptr,
+          const bmssp_config& cfg = bmssp_config())
+        : n(g->get_vertices()), graph(std::move(g)), config(cfg), M(metrics)
+    {
+        init();
+    }
 
-        max_depth = std::max(1, (int)std::log2(std::max(2, n)));
-        if (M) M->assign();
+    // El equipo guarda this: ni copias ni movimientos
+    bmssp(const bmssp&) = delete;
+    bmssp& operator=(const bmssp&) = delete;
+
+    ~bmssp() {
+        if (team.empty()) return;
+        stop = true;
+        start->wait();
+        for (auto& th : team) th.join();
     }
 
     void addEdge(int u, int v, T w) {
-        adj[u].emplace_back(v, w);
+        graph.add_edge(u, v, w);
         if (M) {
             M->access();
             M->assign(3);
         }
     }
 
-    void prepare_graph(bool /*unused*/) {}
+    // Construir el CSR (si hay aristas pendientes) antes de medir
+    void prepare_graph(bool /*unused*/) {
+        csr = &graph.get();
+    }
+
+    // Nombre de la cola de prioridad usada
+    static const char* queue_name() { return Queue<T>::name(); }
+
+    // Parámetros efectivos (max_depth ya resuelto)
+    const bmssp_config& get_config() const { return config; }
 
     std::pair<std::vector<T>, std::vector<int>> execute(int source) {
-        std::fill(dist.begin(), dist.end(), INF);
-        std::fill(pred.begin(), pred.end(), -1);
-        std::fill(visited.begin(), visited.end(), false);
-        if (M) M->assign(3 * n);
+        execute(source, own);
+        return {own.dist, own.pred};
+    }
+
+    // Igual que execute, pero sobre un workspace del llamador: no hay
+    // copia de resultados (leerlos con ws.distances()/predecessors())
+    void execute(int source, SSSPWorkspace<T>& workspace) {
+        csr = &graph.get();
+        ws = &workspace;
 
-        dist[source] = 0;
-        pred[source] = source;
+        // Reinicio O(tocados) salvo la primera vez
+        if (M) M->assign(3 * (ws->dist.size() == (std::size_t)n ? ws->touched_count() : n));
+        ws->reset(n, INF);
+
+        relax(source, 0, source);
         if (M) M->assign(2);
 
-        std::vector<int> S = {source};
+        frontier.clear();
+        frontier.push_back(source);
         if (M) M->assign();
 
-        bmsspRec(S, INF, 0);
+        bmsspLevels(INF);
 
-        // Corrección final (asegura optimalidad)
+        // Corrección final (asegura optimalidad) solo desde los
+        // vértices que quedaron sin relajar
         finalCorrectionDijkstra();
 
-        return {dist, pred};
+        // Dejar la copia atómica en infinito para la próxima consulta
+        if (shared_dist) {
+            for (int v : ws->touched) {
+                shared_dist[v].store(INF, std::memory_order_relaxed);
+                shared_done[v].store(0, std::memory_order_relaxed);
+            }
+        }
     }
 
 private:
+    // Nueva distancia para v: si ya había relajado sus aristas con la
+    // distancia anterior, deja de estar visitado (hay que volver a
+    // relajarlas, aquí o en la corrección final)
+    void relax(int v, T d, int u) {
+        ws->update(v, d, u);
+        ws->visited[v] = false;
+        if (shared_dist) {
+            shared_dist[v].store(d, std::memory_order_relaxed);
+            shared_done[v].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // u relajó sus aristas con su distancia actual
+    void markVisited(int u) {
+        ws->visited[u] = true;
+        if (shared_done) shared_done[u].store(1, std::memory_order_relaxed);
+    }
+
+    void init() {
+        own.reset(n, INF);
+        pq.init(n);
+        frontier.reserve(n);
+        next.reserve(n);
+        pivots.reserve(n);
+
+        if (M) M->assign(4 * n);
+
+        if (config.max_depth <= 0) {
+            config.max_depth = (int)std::log2(std::max(2, n));
+        }
+        config.base_limit = std::max(1, config.base_limit);
+        config.quota_factor = std::max(1, config.quota_factor);
+        config.pivot_threshold = std::max(1, config.pivot_threshold);
+        config.max_depth = std::max(1, config.max_depth);
+        if (config.threads <= 0) {
+            config.threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        if (M) M->assign(4);
+
+        if (config.threads > 1) {
+            shared_dist.reset(new std::atomic<T>[n]);
+            shared_done.reset(new std::atomic<char>[n]);
+            for (int v = 0; v < n; ++v) {
+                shared_dist[v].store(INF, std::memory_order_relaxed);
+                shared_done[v].store(0, std::memory_order_relaxed);
+            }
+            workers.resize(config.threads);
+            for (auto& w : workers) w.pq.init(n);
+            mark.assign(n, 0);
+
+            start.reset(new ThreadBarrier(config.threads));
+            finish.reset(new ThreadBarrier(config.threads));
+            for (int id = 1; id < config.threads; ++id) {
+                team.emplace_back([this, id]() {
+                    while (true) {
+                        start->wait();
+                        if (stop) return;
+                        if (id < groups) work(id);
+                        finish->wait();
+                    }
+                });
+            }
+        }
+    }
+
     // =====================================================
     // Base case: Dijkstra acotado
     // =====================================================
-    void baseCase(int src, T B, int limit = 8) {
-        using State = std::pair<T,int>;
-        std::priority_queue<State, std::vector<State>, std::greater<State>> pq;
+    void baseCase(int src, T B) {
+        const int limit = config.base_limit;
+        const std::vector<T>& dist = ws->dist;
+        std::vector<char>& visited = ws->visited;
 
-        pq.push({dist[src], src});
+        pq.clear();
+        pq.push(src, dist[src]);
         if (M) {
             M->call();
             M->access();
@@ -93,8 +270,7 @@ private:
         while (!pq.empty() && processed < limit) {
             if (M) M->compare(2);
 
-            auto [d,u] = pq.top();
-            pq.pop();
+            auto [d,u] = pq.pop();
             if (M) {
                 M->call(2);
                 M->assign(2);
@@ -107,11 +283,13 @@ private:
                 M->access();
             }
 
-            visited[u] = true;
+            markVisited(u);
             processed++;
             if (M) M->assign(2);
 
-            for (auto &[v,w] : adj[u]) {
+            for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                int v = csr->target(e);
+                T w = csr->weight(e);
                 if (dist[u] + w < dist[v] && dist[u] + w < B) {
                     if (M) {
                         M->compare(2);
@@ -120,9 +298,8 @@ private:
                         M->assign(2);
                     }
 
-                    dist[v] = dist[u] + w;
-                    pred[v] = u;
-                    pq.push({dist[v], v});
+                    relax(v, dist[u] + w, u);
+                    pq.push(v, dist[v]);
                     if (M) M->call();
                 }
             }
@@ -132,15 +309,19 @@ private:
     // =====================================================
     // Selección heurística de pivotes
     // =====================================================
-    std::vector<int> findPivots(const std::vector<int>& S, T B) {
-        std::vector<int> pivots;
+    // Pivotes de frontier (resultado en pivots)
+    void findPivots(T B) {
+        const std::vector<T>& dist = ws->dist;
+        pivots.clear();
         if (M) M->assign();
 
-        for (int u : S) {
+        for (int u : frontier) {
             int relax = 0;
             if (M) M->assign();
 
-            for (auto &[v,w] : adj[u]) {
+            for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                int v = csr->target(e);
+                T w = csr->weight(e);
                 if (dist[u] + w < dist[v] && dist[u] + w < B) {
                     relax++;
                     if (M) {
@@ -152,7 +333,7 @@ private:
                 }
             }
 
-            if (relax >= 2) {
+            if (relax >= config.pivot_threshold) {
                 pivots.push_back(u);
                 if (M) {
                     M->compare();
@@ -162,110 +343,268 @@ private:
         }
 
         if (pivots.empty()) {
-            pivots = S;
+            pivots.assign(frontier.begin(), frontier.end());
             if (M) M->assign();
         }
-
-        return pivots;
     }
 
     // =====================================================
-    // BMSSP recursivo
+    // BMSSP por niveles
+    //
+    // La recursión original era de cola (cada nivel terminaba
+    // llamando al siguiente con su nextS), así que alcanza con
+    // un ciclo que alterna frontier y next, sin pila ni copias.
+    //
+    // En modo paralelo el S del nivel siguiente es la frontera
+    // que deja el nivel (vértices tocados sin visitar) y un
+    // caso base no termina la búsqueda; así los niveles con
+    // varios pivotes llegan a ejecutarse desde una sola fuente
     // =====================================================
-    void bmsspRec(const std::vector<int>& S, T B, int depth) {
-        if (S.empty() || depth >= max_depth) {
-            if (M) M->compare(2);
-            return;
-        }
+    void bmsspLevels(T B) {
+        const std::vector<T>& dist = ws->dist;
+        std::vector<char>& visited = ws->visited;
+
+        for (int depth = 0; ; ++depth) {
+            if (frontier.empty() || depth >= config.max_depth) {
+                if (M) M->compare(2);
+                return;
+            }
 
-        if (S.size() == 1) {
-            if (M) M->compare();
-            baseCase(S[0], B);
-            return;
-        }
+            if (frontier.size() == 1) {
+                if (M) M->compare();
+                baseCase(frontier[0], B);
+                if (config.threads == 1) return;
 
-        auto pivots = findPivots(S, B);
-        if (M) M->assign();
+                frontier.clear();
+                for (int v : ws->touched) {
+                    if (!visited[v]) frontier.push_back(v);
+                }
+                continue;
+            }
 
-        using State = std::pair<T,int>;
-        std::priority_queue<State, std::vector<State>, std::greater<State>> pq;
+            findPivots(B);
+            if (M) M->assign();
 
-        for (int u : pivots) {
-            pq.push({dist[u], u});
-            if (M) {
-                M->call();
-                M->access();
+            int quota = config.quota_factor * (int)frontier.size();
+            if (config.threads > 1) {
+                parallelLevel(B, quota);
+                frontier.swap(next);
+                continue;
             }
-        }
-
-        std::vector<int> nextS;
-        int quota = 4 * (int)S.size();
-        if (M) M->assign(2);
 
-        while (!pq.empty() && (int)nextS.size() < quota) {
-            if (M) M->compare(2);
+            pq.clear();
 
-            auto [d,u] = pq.top();
-            pq.pop();
-            if (M) {
-                M->call(2);
-                M->assign(2);
+            for (int u : pivots) {
+                pq.push(u, dist[u]);
+                if (M) {
+                    M->call();
+                    M->access();
+                }
             }
 
-            if (visited[u]) continue;
-            visited[u] = true;
-            nextS.push_back(u);
+            next.clear();
             if (M) M->assign(2);
 
-            for (auto &[v,w] : adj[u]) {
-                if (dist[u] + w < dist[v] && dist[u] + w < B) {
-                    if (M) {
-                        M->compare(2);
-                        M->arithmetic();
-                        M->access(2);
-                        M->assign(2);
+            while (!pq.empty() && (int)next.size() < quota) {
+                if (M) M->compare(2);
+
+                auto [d,u] = pq.pop();
+                if (M) {
+                    M->call(2);
+                    M->assign(2);
+                }
+
+                if (visited[u]) continue;
+                markVisited(u);
+                next.push_back(u);
+                if (M) M->assign(2);
+
+                for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                    int v = csr->target(e);
+                    T w = csr->weight(e);
+                    if (dist[u] + w < dist[v] && dist[u] + w < B) {
+                        if (M) {
+                            M->compare(2);
+                            M->arithmetic();
+                            M->access(2);
+                            M->assign(2);
+                        }
+
+                        relax(v, dist[u] + w, u);
+                        pq.push(v, dist[v]);
+                        if (M) M->call();
                     }
+                }
+            }
 
-                    dist[v] = dist[u] + w;
-                    pred[v] = u;
-                    pq.push({dist[v], v});
-                    if (M) M->call();
+            frontier.swap(next);
+        }
+    }
+
+    // =====================================================
+    // Nivel en paralelo
+    //
+    // Los pivotes se ordenan por distancia y se reparten en
+    // grupos contiguos, uno por hilo; el grupo i solo relaja
+    // por debajo de la distancia del primer pivote del grupo
+    // i + 1, así cada hilo trabaja en un intervalo de cotas
+    // disjunto. Cada hilo extrae con su propia cola hasta
+    // quota / hilos vértices y baja dist con un mínimo
+    // atómico. El predecesor se elige al unir: cualquier
+    // relajación que haya dado la distancia final. El nivel
+    // deja en next la frontera: vértices de S y relajados
+    // que siguen sin visitar.
+    //
+    // visited se reclama con exchange; si u mejora mientras
+    // su dueño relaja, quien lo mejora o el dueño (al volver
+    // a leer dist) lo desmarca y queda para la corrección.
+    // También queda sin visitar si la cota le cortó alguna
+    // arista que mejoraba
+    // =====================================================
+    void parallelLevel(T B, int quota) {
+        const std::vector<T>& dist = ws->dist;
+        std::sort(pivots.begin(), pivots.end(), [&](int a, int b) {
+            return dist[a] < dist[b];
+        });
+
+        groups = std::min<int>(config.threads, (int)pivots.size());
+        share = std::max(1, quota / groups);
+        for (int id = 0; id < groups; ++id) {
+            std::size_t end = pivots.size() * (id + 1) / groups;
+            workers[id].bound = end < pivots.size() ? std::min(B, dist[pivots[end]]) : B;
+        }
+
+        if (groups == 1) {
+            work(0);
+        }
+        else {
+            start->wait();
+            work(0);
+            finish->wait();
+        }
+
+        // Unir en el workspace (un solo hilo)
+        for (int id = 0; id < groups; ++id) {
+            Worker& w = workers[id];
+            for (const auto& r : w.relaxed) {
+                if (r.d == shared_dist[r.v].load(std::memory_order_relaxed) && r.d != dist[r.v]) {
+                    ws->update(r.v, r.d, r.u);
                 }
+                ws->visited[r.v] = shared_done[r.v].load(std::memory_order_relaxed);
+            }
+            for (int u : w.found) {
+                ws->visited[u] = shared_done[u].load(std::memory_order_relaxed);
+            }
+            if (M) {
+                M->arithmetic(w.relaxations);
+                M->assign(w.found.size() + 3 * w.relaxed.size());
             }
         }
 
-        bmsspRec(nextS, B, depth + 1);
+        next.clear();
+        ++epoch;
+        auto add = [&](int v) {
+            if (!ws->visited[v] && mark[v] != epoch) {
+                mark[v] = epoch;
+                next.push_back(v);
+            }
+        };
+        for (int v : frontier) add(v);
+        for (int id = 0; id < groups; ++id) {
+            for (const auto& r : workers[id].relaxed) add(r.v);
+        }
+    }
+
+    bool atomic_min(int v, T d) {
+        T old = shared_dist[v].load(std::memory_order_relaxed);
+        while (d < old) {
+            if (shared_dist[v].compare_exchange_weak(old, d)) return true;
+        }
+        return false;
+    }
+
+    // Subproblema del grupo id en parallelLevel
+    void work(int id) {
+        const std::vector<T>& dist = ws->dist;
+        Worker& w = workers[id];
+        w.pq.clear();
+        w.relaxed.clear();
+        w.found.clear();
+        w.relaxations = 0;
+
+        std::size_t begin = pivots.size() * id / groups;
+        std::size_t end = pivots.size() * (id + 1) / groups;
+        for (std::size_t i = begin; i < end; ++i) {
+            w.pq.push(pivots[i], dist[pivots[i]]);
+        }
+
+        while (!w.pq.empty() && (int)w.found.size() < share) {
+            auto [d,u] = w.pq.pop();
+            if (d != shared_dist[u].load() || shared_done[u].exchange(1)) continue;
+            w.found.push_back(u);
+
+            bool cut = false;   // alguna mejora quedó fuera de la cota
+            for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                int v = csr->target(e);
+                T nd = d + csr->weight(e);
+                w.relaxations++;
+                if (nd >= w.bound) {
+                    cut = cut || nd < shared_dist[v].load(std::memory_order_relaxed);
+                }
+                else if (atomic_min(v, nd)) {
+                    shared_done[v].store(0);
+                    w.relaxed.push_back({v, nd, u});
+                    w.pq.push(v, nd);
+                }
+            }
+
+            // Sin visitar si mejoró mientras se relajaban sus
+            // aristas o si la cota dejó alguna sin relajar
+            if (cut || shared_dist[u].load() != d) shared_done[u].store(0);
+        }
     }
 
     // =====================================================
-    // Corrección final con Dijkstra completo
+    // Corrección final: Dijkstra desde los vértices tocados
+    // que no están visitados (la frontera que dejó bmsspLevels
+    // y los que mejoraron después de relajar sus aristas).
+    // Los visitados ya cumplen dist[v] <= dist[u] + w en
+    // todas sus aristas, así que no hace falta volver a
+    // recorrerlos salvo que mejoren acá.
     // =====================================================
     void finalCorrectionDijkstra() {
-        using State = std::pair<T,int>;
-        std::priority_queue<State, std::vector<State>, std::greater<State>> pq;
+        const std::vector<T>& dist = ws->dist;
+        std::vector<char>& visited = ws->visited;
+        pq.clear();
 
-        for (int i = 0; i < n; i++) {
-            if (dist[i] < INF) {
-                pq.push({dist[i], i});
-                if (M) {
-                    M->compare();
-                    M->call();
-                }
-            }
+        // Los vértices con distancia finita son exactamente los tocados
+        for (int i : ws->touched) {
+            if (M) M->compare();
+            if (visited[i]) continue;
+
+            pq.push(i, dist[i]);
+            if (M) M->call();
         }
 
         while (!pq.empty()) {
-            auto [d,u] = pq.top();
-            pq.pop();
+            auto [d,u] = pq.pop();
             if (M) {
                 M->call(2);
                 M->assign(2);
             }
 
-            if (d != dist[u]) continue;
-            if (M) M->compare();
+            if (d != dist[u] || visited[u]) continue;
+            if (M) M->compare(2);
+
+            markVisited(u);
+            if (M) {
+                M->assign();
+                M->correct();
+            }
 
-            for (auto &[v,w] : adj[u]) {
+            for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                int v = csr->target(e);
+                T w = csr->weight(e);
                 if (dist[u] + w < dist[v]) {
                     if (M) {
                         M->compare();
@@ -274,9 +613,8 @@ private:
                         M->assign(2);
                     }
 
-                    dist[v] = dist[u] + w;
-                    pred[v] = u;
-                    pq.push({dist[v], v});
+                    relax(v, dist[u] + w, u);
+                    pq.push(v, dist[v]);
                     if (M) M->call();
                 }
             }
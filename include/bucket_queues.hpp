@@ -0,0 +1,151 @@
+#ifndef BUCKET_QUEUES_HPP
+#define BUCKET_QUEUES_HPP
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+
+// =====================================================
+// Colas monótonas para pesos enteros no negativos
+//
+// Misma interfaz que las colas de priority_queues.hpp,
+// pero solo válidas cuando las claves extraídas nunca
+// decrecen (Dijkstra con pesos >= 0). No sirven para
+// BMSSP, cuyas búsquedas acotadas no son monótonas.
+// Ambas usan borrado perezoso: Dijkstra descarta las
+// entradas obsoletas al extraerlas.
+// =====================================================
+
+// =====================================================
+// Dial: arreglo circular de C + 1 buckets, con C el peso
+// máximo. Toda clave pendiente está en [actual, actual + C]
+// =====================================================
+template<typename K>
+class DialQueue {
+    static_assert(std::is_integral<K>::value, "Dial requiere claves enteras");
+
+private:
+    std::vector<std::vector<int>> buckets;
+    K current = 0;          // última clave extraída (cota inferior de la cola)
+    std::size_t count = 0;
+    bool fresh = true;      // sin inserciones desde clear()
+
+public:
+    static constexpr bool uses_max_weight = true;
+
+    void init(int /*n*/, K max_weight = 0) {
+        buckets.assign((std::size_t)max_weight + 1, {});
+        current = 0;
+        count = 0;
+        fresh = true;
+    }
+
+    void clear() {
+        if (count > 0) {
+            for (auto& b : buckets) b.clear();
+        }
+        current = 0;
+        count = 0;
+        fresh = true;
+    }
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    void push(int v, K key) {
+        // La primera clave fija el origen del recorrido circular
+        if (fresh) {
+            current = key;
+            fresh = false;
+        }
+        buckets[key % buckets.size()].push_back(v);
+        count++;
+    }
+
+    std::pair<K, int> pop() {
+        std::size_t i = current % buckets.size();
+        while (buckets[i].empty()) {
+            current++;
+            if (++i == buckets.size()) i = 0;
+        }
+        int v = buckets[i].back();
+        buckets[i].pop_back();
+        count--;
+        return {current, v};
+    }
+
+    static const char* name() { return "dial"; }
+};
+
+// =====================================================
+// Radix heap: bucket i guarda las claves cuyo bit más
+// alto distinto de la última extraída es el (i - 1).
+// Amortizado O(log C) por operación, sin límite práctico
+// en el rango de pesos
+// =====================================================
+template<typename K>
+class RadixHeap {
+    static_assert(std::is_integral<K>::value, "radix heap requiere claves enteras");
+
+private:
+    using U = typename std::make_unsigned<K>::type;
+    static constexpr int BUCKETS = sizeof(K) * 8 + 1;
+
+    std::vector<std::pair<K, int>> buckets[BUCKETS];
+    K last = 0;             // última clave extraída
+    std::size_t count = 0;
+
+    static int bucket_of(K key, K last) {
+        U x = (U)key ^ (U)last;
+        return x == 0 ? 0 : (int)(sizeof(unsigned long long) * 8)
+                            - __builtin_clzll((unsigned long long)x);
+    }
+
+public:
+    static constexpr bool uses_max_weight = false;
+
+    void init(int /*n*/, K /*max_weight*/ = 0) { clear(); }
+
+    void clear() {
+        for (auto& b : buckets) b.clear();
+        last = 0;
+        count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    void push(int v, K key) {
+        buckets[bucket_of(key, last)].push_back({key, v});
+        count++;
+    }
+
+    std::pair<K, int> pop() {
+        if (buckets[0].empty()) {
+            // Redistribuir el primer bucket no vacío respecto de su mínimo
+            int i = 1;
+            while (buckets[i].empty()) ++i;
+
+            K min_key = buckets[i][0].first;
+            for (const auto& e : buckets[i]) {
+                if (e.first < min_key) min_key = e.first;
+            }
+            last = min_key;
+
+            for (const auto& e : buckets[i]) {
+                buckets[bucket_of(e.first, last)].push_back(e);
+            }
+            buckets[i].clear();
+        }
+
+        auto top = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return top;
+    }
+
+    static const char* name() { return "radix"; }
+};
+
+#endif // BUCKET_QUEUES_HPP
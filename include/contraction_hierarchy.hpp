@@ -0,0 +1,488 @@
+#ifndef CONTRACTION_HIERARCHY_HPP
+#define CONTRACTION_HIERARCHY_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "priority_queues.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <functional>
+
+// =====================================================
+// Contraction Hierarchies (CH)
+//
+// Preprocesamiento: los vértices se contraen de a uno en
+// orden de "edge difference" (atajos agregados - aristas
+// eliminadas + vecinos ya contraídos, con actualización
+// perezosa). Al contraer v, para cada par u -> v -> w se
+// busca un camino testigo u -> w que no pase por v
+// (Dijkstra local acotado); si no existe se agrega el
+// atajo u -> w.
+//
+// Cada arista queda en el grafo "up" (hacia un vértice de
+// mayor rango) o en el "down" (guardada invertida en el
+// extremo de menor rango). La consulta es un Dijkstra
+// bidireccional que solo sube: adelante por up desde s y
+// atrás por down desde t.
+//
+// En grafos aleatorios (sin la jerarquía natural de una
+// red vial) el grafo restante se densifica; cuando incluso
+// el vértice de menor prioridad tiene más de core_limit
+// pares entrada x salida se deja de contraer. Los vértices
+// restantes forman el "núcleo": comparten el rango máximo
+// y sus aristas están en up y en down, de modo que la
+// consulta hace un Dijkstra bidireccional común dentro de él.
+// =====================================================
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
+class ContractionHierarchy {
+public:
+    using graph_type = G;
+    using distance_type = T;
+    using queue_type = Queue<T>;
+
+    // Los atajos suman pesos: se guardan con el tipo de distancia
+    using Hierarchy = CSRGraph<T, typename G::vertex_type, typename G::edge_type>;
+
+    // Límite de vértices asentados por búsqueda de testigos (al
+    // contraer y, más corto, al simular para calcular prioridades)
+    static constexpr int WITNESS_SETTLE_LIMIT = 100;
+    static constexpr int SIMULATION_SETTLE_LIMIT = 20;
+
+    // Pares entrada x salida a partir de los cuales se deja el núcleo
+    static constexpr long long CORE_DEGREE_PRODUCT = 1024;
+
+private:
+    using EId = typename G::edge_type;
+
+    struct Arc {
+        int to;
+        T weight;
+        int mid;   // vértice contraído que reemplaza (-1 si es original)
+    };
+
+    int n;  // número de vértices
+    std::shared_ptr<const G> graph;  // grafo CSR compartido (solo lectura)
+
+    std::vector<int> rank;           // orden de contracción
+    std::unique_ptr<Hierarchy> up;   // u -> w con rank[u] < rank[w]
+    std::unique_ptr<Hierarchy> down; // en w: u con arista u -> w y rank[u] > rank[w]
+    std::vector<int> up_mid, down_mid;
+    long long shortcuts = 0;
+    long long core_limit;
+    int core_size = 0;
+
+    // Estado de la consulta (se reinicia solo lo tocado)
+    std::vector<T> dist_f, dist_b;
+    std::vector<int> pred_f, pred_b;
+    std::vector<int> touched;
+    Queue<T> pq_f, pq_b;
+    int source = -1, target = -1, meet = -1;
+    T mu;
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    // =====================================================
+    // Preprocesamiento
+    // =====================================================
+    struct Contractor {
+        std::vector<std::vector<Arc>> out, in;
+        std::vector<char> contracted;
+        std::vector<int> deleted_neighbors;
+
+        // Dijkstra local para testigos; need[w] es la longitud
+        // del camino u -> v -> w que hay que igualar
+        std::vector<T> wdist, need;
+        std::vector<int> wtouched;
+        Queue<T> wpq;
+
+        explicit Contractor(int n)
+            : out(n), in(n), contracted(n, 0), deleted_neighbors(n, 0),
+              wdist(n, INF), need(n, INF) {
+            wpq.init(n);
+        }
+
+        static void upsert(std::vector<Arc>& arcs, int to, T weight, int mid) {
+            for (Arc& a : arcs) {
+                if (a.to == to) {
+                    if (weight < a.weight) {
+                        a.weight = weight;
+                        a.mid = mid;
+                    }
+                    return;
+                }
+            }
+            arcs.push_back({to, weight, mid});
+        }
+
+        static void erase(std::vector<Arc>& arcs, int to) {
+            for (std::size_t i = 0; i < arcs.size(); ++i) {
+                if (arcs[i].to == to) {
+                    arcs[i] = arcs.back();
+                    arcs.pop_back();
+                    return;
+                }
+            }
+        }
+
+        // Distancias desde u sin pasar por v, hasta superar limit o
+        // hasta que los `pending` destinos tengan testigo
+        void witness_search(int u, int v, T limit, int settle_limit, int pending) {
+            for (int x : wtouched) wdist[x] = INF;
+            wtouched.clear();
+            wpq.clear();
+
+            wdist[u] = 0;
+            wtouched.push_back(u);
+            wpq.push(u, 0);
+
+            int settled = 0;
+            while (!wpq.empty() && settled < settle_limit && pending > 0) {
+                auto [d, x] = wpq.pop();
+                if (d > wdist[x]) continue;
+                if (d > limit) break;
+                settled++;
+
+                for (const Arc& a : out[x]) {
+                    if (a.to == v || contracted[a.to]) continue;
+                    T nd = d + a.weight;
+                    if (nd < wdist[a.to]) {
+                        if (wdist[a.to] == INF) wtouched.push_back(a.to);
+                        if (wdist[a.to] > need[a.to] && nd <= need[a.to]) pending--;
+                        wdist[a.to] = nd;
+                        wpq.push(a.to, nd);
+                    }
+                }
+            }
+        }
+
+        // Atajos necesarios al contraer v; si apply, se agregan
+        int contract(int v, bool apply) {
+            T max_out = 0;
+            for (const Arc& b : out[v]) max_out = std::max(max_out, b.weight);
+
+            int added = 0;
+            for (const Arc& a : in[v]) {
+                int u = a.to;
+                int pending = 0;
+                for (const Arc& b : out[v]) {
+                    if (b.to == u) continue;
+                    need[b.to] = a.weight + b.weight;
+                    pending++;
+                }
+                witness_search(u, v, a.weight + max_out,
+                               apply ? WITNESS_SETTLE_LIMIT : SIMULATION_SETTLE_LIMIT,
+                               pending);
+                for (const Arc& b : out[v]) need[b.to] = INF;
+
+                for (const Arc& b : out[v]) {
+                    int w = b.to;
+                    if (w == u) continue;
+                    T via = a.weight + b.weight;
+                    if (wdist[w] <= via) continue;   // hay testigo
+
+                    added++;
+                    if (apply) {
+                        upsert(out[u], w, via, v);
+                        upsert(in[w], u, via, v);
+                    }
+                }
+            }
+            return added;
+        }
+
+        // Edge difference + vecinos contraídos; sobre el límite del
+        // núcleo se evita simular (vale el producto de grados)
+        long long priority(int v, long long core_limit) {
+            long long pairs = (long long)in[v].size() * (long long)out[v].size();
+            if (pairs > core_limit) {
+                return pairs;
+            }
+            long long removed = in[v].size() + out[v].size();
+            return contract(v, false) - removed + deleted_neighbors[v];
+        }
+
+        // Quitar v del grafo restante
+        void remove(int v) {
+            contracted[v] = 1;
+            for (const Arc& a : in[v]) {
+                erase(out[a.to], v);
+                deleted_neighbors[a.to]++;
+            }
+            for (const Arc& b : out[v]) {
+                erase(in[b.to], v);
+                deleted_neighbors[b.to]++;
+            }
+        }
+    };
+
+    void preprocess() {
+        Contractor c(n);
+        for (int u = 0; u < n; ++u) {
+            for (EId e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+                int v = graph->target(e);
+                if (v == u) continue;
+                T w = static_cast<T>(graph->weight(e));
+                Contractor::upsert(c.out[u], v, w, -1);
+                Contractor::upsert(c.in[v], u, w, -1);
+            }
+        }
+
+        // Cola de prioridad (prioridad, vértice) con actualización perezosa
+        using Entry = std::pair<long long, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> order;
+        for (int v = 0; v < n; ++v) {
+            order.push({c.priority(v, core_limit), v});
+        }
+
+        std::vector<typename Hierarchy::Edge> up_edges, down_edges;
+        std::vector<int> up_mids, down_mids;
+
+        rank.assign(n, -1);
+        shortcuts = 0;
+        int next_rank = 0;
+        while (!order.empty()) {
+            auto [p, v] = order.top();
+            order.pop();
+            if (c.contracted[v]) continue;
+
+            // Recalcular; si ya no es el mínimo, volver a encolar
+            long long current = c.priority(v, core_limit);
+            if (!order.empty() && current > order.top().first) {
+                order.push({current, v});
+                continue;
+            }
+            if ((long long)c.in[v].size() * (long long)c.out[v].size() > core_limit) {
+                break;
+            }
+
+            // Aristas hacia vértices aún no contraídos (de mayor rango)
+            for (const Arc& b : c.out[v]) {
+                up_edges.push_back({v, b.to, b.weight});
+                up_mids.push_back(b.mid);
+            }
+            for (const Arc& a : c.in[v]) {
+                down_edges.push_back({v, a.to, a.weight});
+                down_mids.push_back(a.mid);
+            }
+
+            shortcuts += c.contract(v, true);
+            c.remove(v);
+            rank[v] = next_rank++;
+        }
+
+        // Núcleo: aristas internas en ambos sentidos, rango máximo
+        core_size = 0;
+        for (int v = 0; v < n; ++v) {
+            if (c.contracted[v]) continue;
+            core_size++;
+            rank[v] = next_rank;
+            for (const Arc& b : c.out[v]) {
+                up_edges.push_back({v, b.to, b.weight});
+                up_mids.push_back(b.mid);
+                down_edges.push_back({b.to, v, b.weight});
+                down_mids.push_back(b.mid);
+            }
+        }
+
+        up = build(up_edges, up_mids, up_mid);
+        down = build(down_edges, down_mids, down_mid);
+    }
+
+    // CSR de la jerarquía; mid se reordena igual que las aristas
+    std::unique_ptr<Hierarchy> build(const std::vector<typename Hierarchy::Edge>& edges,
+                                     const std::vector<int>& mids,
+                                     std::vector<int>& mid_out) {
+        std::vector<EId> offsets(n + 1, 0);
+        for (const auto& e : edges) offsets[e.u + 1]++;
+        for (int v = 0; v < n; ++v) offsets[v + 1] += offsets[v];
+
+        std::vector<typename G::vertex_type> targets(edges.size());
+        std::vector<T> weights(edges.size());
+        mid_out.assign(edges.size(), -1);
+
+        std::vector<EId> cursor(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            EId pos = cursor[edges[i].u]++;
+            targets[pos] = static_cast<typename G::vertex_type>(edges[i].v);
+            weights[pos] = edges[i].weight;
+            mid_out[pos] = mids[i];
+        }
+
+        return std::make_unique<Hierarchy>(Hierarchy::from_arrays(
+            n, std::move(offsets), std::move(targets), std::move(weights)));
+    }
+
+    // =====================================================
+    // Consulta
+    // =====================================================
+    T step(const Hierarchy& h, Queue<T>& pq, std::vector<T>& dist, std::vector<int>& pred,
+           const std::vector<T>& other, Metrics* M) {
+        auto [d, u] = pq.pop();
+        if (M) {
+            M->call(2);
+            M->assign(2);
+        }
+        if (d > dist[u]) {
+            if (M) M->compare();
+            return d;
+        }
+        if (M) M->settle();
+
+        if (other[u] != INF && d + other[u] < mu) {
+            mu = d + other[u];
+            meet = u;
+            if (M) M->assign(2);
+        }
+
+        for (EId e = h.edge_begin(u); e < h.edge_end(u); ++e) {
+            if (M) M->access(2);
+            int v = h.target(e);
+            T nd = d + h.weight(e);
+            if (M) M->arithmetic();
+
+            if (nd < dist[v]) {
+                if (M) {
+                    M->compare();
+                    M->assign(2);
+                    M->call();
+                }
+                if (dist_f[v] == INF && dist_b[v] == INF) touched.push_back(v);
+                dist[v] = nd;
+                pred[v] = u;
+                pq.push(v, nd);
+            }
+        }
+        return d;
+    }
+
+    // Arista (a, b) de la jerarquía con su peso mínimo; devuelve mid
+    // (las del núcleo, de igual rango, se buscan en up)
+    int find_mid(int a, int b) const {
+        bool upward = rank[a] <= rank[b];
+        const Hierarchy& h = upward ? *up : *down;
+        const std::vector<int>& mids = upward ? up_mid : down_mid;
+        int from = upward ? a : b;
+        int to = upward ? b : a;
+
+        EId best = -1;
+        for (EId e = h.edge_begin(from); e < h.edge_end(from); ++e) {
+            if (h.target(e) == to && (best < 0 || h.weight(e) < h.weight(best))) best = e;
+        }
+        return best < 0 ? -1 : mids[best];
+    }
+
+    // Expandir recursivamente los atajos de a -> b
+    void unpack(int a, int b, std::vector<int>& path) const {
+        int m = find_mid(a, b);
+        if (m < 0) {
+            path.push_back(b);
+            return;
+        }
+        unpack(a, m, path);
+        unpack(m, b, path);
+    }
+
+public:
+    explicit ContractionHierarchy(std::shared_ptr<const G> g,
+                                  long long core_degree_product = CORE_DEGREE_PRODUCT)
+        : n(g->get_vertices()), graph(std::move(g)),
+          core_limit(core_degree_product), mu(INF) {
+        preprocess();
+
+        dist_f.assign(n, INF);
+        dist_b.assign(n, INF);
+        pred_f.assign(n, -1);
+        pred_b.assign(n, -1);
+        pq_f.init(n);
+        pq_b.init(n);
+    }
+
+    // Distancia más corta de s a t (INF si no hay camino)
+    T query(int s, int t, Metrics* M = nullptr) {
+        for (int v : touched) {
+            dist_f[v] = dist_b[v] = INF;
+            pred_f[v] = pred_b[v] = -1;
+        }
+        if (M) M->assign(4 * touched.size());
+        touched.clear();
+
+        source = s;
+        target = t;
+        meet = -1;
+        mu = INF;
+        if (s < 0 || s >= n || t < 0 || t >= n) {
+            source = target = -1;
+            return INF;
+        }
+
+        pq_f.clear();
+        pq_b.clear();
+        dist_f[s] = 0;
+        dist_b[t] = 0;
+        touched.push_back(s);
+        if (t != s) touched.push_back(t);
+        pq_f.push(s, 0);
+        pq_b.push(t, 0);
+
+        // Cada lado sigue mientras su mínimo pueda mejorar mu
+        bool forward = true;
+        while (!pq_f.empty() || !pq_b.empty()) {
+            if (M) M->compare(2);
+            if (forward && !pq_f.empty()) {
+                if (step(*up, pq_f, dist_f, pred_f, dist_b, M) >= mu) pq_f.clear();
+            }
+            else if (!forward && !pq_b.empty()) {
+                if (step(*down, pq_b, dist_b, pred_b, dist_f, M) >= mu) pq_b.clear();
+            }
+            forward = !forward;
+        }
+
+        return mu;
+    }
+
+    // Camino de la última consulta en el grafo original (atajos expandidos)
+    std::vector<int> get_shortest_path() const {
+        if (source < 0 || mu == INF) {
+            return {};
+        }
+
+        // s -> meet por pred_f y meet -> t por pred_b (en la jerarquía)
+        std::vector<int> up_part, down_part;
+        for (int x = meet; x != -1; x = pred_f[x]) up_part.push_back(x);
+        std::reverse(up_part.begin(), up_part.end());
+        for (int x = meet; x != -1; x = pred_b[x]) down_part.push_back(x);
+
+        std::vector<int> hops = up_part;
+        hops.insert(hops.end(), down_part.begin() + 1, down_part.end());
+
+        std::vector<int> path{hops[0]};
+        for (std::size_t i = 0; i + 1 < hops.size(); ++i) {
+            unpack(hops[i], hops[i + 1], path);
+        }
+        return path;
+    }
+
+    // Distancia de la última consulta
+    T get_distance() const { return mu; }
+
+    // Getters
+    int get_vertices() const { return n; }
+    long long get_shortcuts() const { return shortcuts; }
+    int get_core_size() const { return core_size; }
+    const std::vector<int>& get_rank() const { return rank; }
+    const Hierarchy& get_upward() const { return *up; }
+    const Hierarchy& get_downward() const { return *down; }
+
+    // Nombre de la cola de prioridad usada
+    static const char* queue_name() { return Queue<T>::name(); }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,307 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include "weight_stats.hpp"
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+
+// =====================================================
+// Vista de solo lectura sobre un arreglo contiguo
+// (memoria propia o mapeada desde disco)
+// =====================================================
+template<typename T>
+class ArrayView {
+private:
+    const T* ptr;
+    std::size_t len;
+
+public:
+    ArrayView() : ptr(nullptr), len(0) {}
+    ArrayView(const T* data, std::size_t size) : ptr(data), len(size) {}
+
+    const T& operator[](std::size_t i) const { return ptr[i]; }
+    const T* data() const { return ptr; }
+    std::size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + len; }
+};
+
+// =====================================================
+// Grafo dirigido inmutable en formato CSR
+// (compressed sparse row): offsets, targets, weights.
+// Se construye una sola vez y se comparte (solo lectura)
+// entre Dijkstra, BMSSP y Bellman-Ford.
+//
+// Los arreglos pueden vivir en vectores propios o en
+// memoria externa (p. ej. un archivo mapeado con mmap,
+// ver graph_cache.hpp); el acceso es siempre por vistas.
+//
+// Tipos de almacenamiento independientes:
+//   W   peso de arista (puede ser más angosto que el tipo
+//       de distancia de los algoritmos, p. ej. int16_t)
+//   VId ID de vértice guardado en targets (p. ej. uint32_t)
+//   EId posición de arista en offsets
+// =====================================================
+template<typename W, typename VId = int, typename EId = long long>
+class CSRGraph {
+public:
+    using weight_type = W;
+    using vertex_type = VId;
+    using edge_type = EId;
+
+    struct Edge {
+        int u, v;
+        W weight;
+    };
+
+private:
+    int n;  // número de vértices
+
+    // Almacenamiento propio (vacío si los datos son externos)
+    std::vector<EId> offsets_store;
+    std::vector<VId> targets_store;
+    std::vector<W> weights_store;
+
+    // Memoria externa que debe mantenerse viva (mmap)
+    std::shared_ptr<const void> backing;
+
+    // Vistas usadas por los algoritmos
+    const EId* offsets;  // n + 1 posiciones
+    const VId* targets;  // destino de cada arista
+    const W* weights;    // peso de cada arista
+
+    void bind_store() {
+        offsets = offsets_store.data();
+        targets = targets_store.data();
+        weights = weights_store.data();
+    }
+
+public:
+    CSRGraph() : n(0), offsets_store(1, 0) { bind_store(); }
+
+    // Las vistas apuntan al almacenamiento propio: no se permite copiar
+    // (mover un std::vector conserva sus buffers, copiarlo no)
+    CSRGraph(const CSRGraph&) = delete;
+    CSRGraph& operator=(const CSRGraph&) = delete;
+    CSRGraph(CSRGraph&&) = default;
+    CSRGraph& operator=(CSRGraph&&) = default;
+
+    // Construir desde cualquier contenedor de aristas con campos u, v, weight
+    // (GraphLoader<T>::Edge, GraphGenerator<T>::Edge, CSRGraph::Edge).
+    // Counting sort estable por origen: se conserva el orden de entrada
+    // de las aristas de cada vértice. Aristas fuera de rango se ignoran.
+    // Los pesos se convierten a W; se advierte si alguno no cabe.
+    template<typename EdgeContainer>
+    static CSRGraph from_edges(int vertices, const EdgeContainer& edges) {
+        std::vector<EId> offsets(vertices + 1, 0);
+
+        for (const auto& e : edges) {
+            if (in_range(e.u, e.v, vertices)) {
+                offsets[e.u + 1]++;
+            }
+        }
+        for (int u = 0; u < vertices; ++u) {
+            offsets[u + 1] += offsets[u];
+        }
+
+        std::vector<VId> targets(offsets[vertices]);
+        std::vector<W> weights(offsets[vertices]);
+        long long narrowed = 0;
+
+        std::vector<EId> cursor(offsets.begin(), offsets.end() - 1);
+        for (const auto& e : edges) {
+            if (in_range(e.u, e.v, vertices)) {
+                EId pos = cursor[e.u]++;
+                targets[pos] = static_cast<VId>(e.v);
+                weights[pos] = static_cast<W>(e.weight);
+                if (weights[pos] != e.weight) narrowed++;
+            }
+        }
+
+        if (narrowed > 0) {
+            std::cerr << "Advertencia: " << narrowed << " pesos no caben en el "
+                      << "tipo de peso compacto (" << sizeof(W) << " bytes)\n";
+        }
+
+        return from_arrays(vertices, std::move(offsets),
+                           std::move(targets), std::move(weights));
+    }
+
+    // Tomar posesión de arreglos CSR ya armados
+    static CSRGraph from_arrays(int vertices,
+                                std::vector<EId> offsets,
+                                std::vector<VId> targets,
+                                std::vector<W> weights) {
+        CSRGraph g;
+        g.n = vertices;
+        g.offsets_store = std::move(offsets);
+        g.targets_store = std::move(targets);
+        g.weights_store = std::move(weights);
+        g.bind_store();
+        return g;
+    }
+
+    // Envolver arreglos externos sin copiarlos. `owner` mantiene viva
+    // la memoria (por ejemplo, el mapeo del archivo) mientras exista el grafo.
+    static CSRGraph from_views(int vertices,
+                               const EId* offsets,
+                               const VId* targets,
+                               const W* weights,
+                               std::shared_ptr<const void> owner) {
+        CSRGraph g;
+        g.n = vertices;
+        g.offsets_store.clear();
+        g.backing = std::move(owner);
+        g.offsets = offsets;
+        g.targets = targets;
+        g.weights = weights;
+        return g;
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    long long get_edges_count() const { return offsets[n]; }
+
+    // Rango [edge_begin(u), edge_end(u)) de aristas salientes de u
+    EId edge_begin(int u) const { return offsets[u]; }
+    EId edge_end(int u) const { return offsets[u + 1]; }
+    long long degree(int u) const { return offsets[u + 1] - offsets[u]; }
+
+    int target(EId e) const { return targets[e]; }
+    W weight(EId e) const { return weights[e]; }
+
+    // Acceso directo a los arreglos (memoria contigua)
+    ArrayView<EId> get_offsets() const { return {offsets, (std::size_t)n + 1}; }
+    ArrayView<VId> get_targets() const { return {targets, (std::size_t)get_edges_count()}; }
+    ArrayView<W> get_weights() const { return {weights, (std::size_t)get_edges_count()}; }
+
+    // Peso mínimo y máximo (recorre todas las aristas)
+    std::pair<W, W> weight_range() const {
+        EId m = offsets[n];
+        if (m == 0) return {W(), W()};
+        W lo = weights[0], hi = weights[0];
+        for (EId e = 1; e < m; ++e) {
+            if (weights[e] < lo) lo = weights[e];
+            if (weights[e] > hi) hi = weights[e];
+        }
+        return {lo, hi};
+    }
+
+    // Mínimo, máximo y promedio de los pesos (recorre todas las aristas)
+    WeightStats weight_stats() const {
+        return WeightStats::collect(n, [&](auto&& add) {
+            for (EId e = 0; e < offsets[n]; ++e) add(static_cast<double>(weights[e]));
+        });
+    }
+
+    // Bytes ocupados por los arreglos CSR
+    std::size_t memory_bytes() const {
+        return (n + 1) * sizeof(EId) + get_edges_count() * (sizeof(VId) + sizeof(W));
+    }
+
+    // Grafo traspuesto (aristas invertidas), p. ej. para búsquedas hacia atrás
+    CSRGraph reversed() const {
+        std::vector<EId> roffsets(n + 1, 0);
+        EId m = offsets[n];
+
+        for (EId e = 0; e < m; ++e) {
+            roffsets[targets[e] + 1]++;
+        }
+        for (int v = 0; v < n; ++v) {
+            roffsets[v + 1] += roffsets[v];
+        }
+
+        std::vector<VId> rtargets(m);
+        std::vector<W> rweights(m);
+        std::vector<EId> cursor(roffsets.begin(), roffsets.end() - 1);
+
+        for (int u = 0; u < n; ++u) {
+            for (EId e = offsets[u]; e < offsets[u + 1]; ++e) {
+                EId pos = cursor[targets[e]]++;
+                rtargets[pos] = static_cast<VId>(u);
+                rweights[pos] = weights[e];
+            }
+        }
+
+        return from_arrays(n, std::move(roffsets),
+                           std::move(rtargets), std::move(rweights));
+    }
+
+    // true si los arreglos viven en memoria externa (mmap)
+    bool is_mapped() const { return backing != nullptr; }
+
+private:
+    static bool in_range(int u, int v, int vertices) {
+        return u >= 0 && u < vertices && v >= 0 && v < vertices;
+    }
+};
+
+// =====================================================
+// Constructor incremental usado por la API add_edge de
+// los algoritmos: acumula aristas y genera el CSR una
+// sola vez, cuando se necesita. También puede envolver
+// un grafo ya construido y compartido.
+// =====================================================
+template<typename G>
+class CSRGraphBuilder {
+private:
+    using W = typename G::weight_type;
+
+    int n;
+    std::vector<typename G::Edge> edges;  // aristas pendientes
+    std::shared_ptr<const G> graph;       // último CSR construido
+    bool dirty = false;
+
+public:
+    explicit CSRGraphBuilder(int vertices = 0) : n(vertices) {}
+
+    explicit CSRGraphBuilder(std::shared_ptr<const G> g)
+        : n(g->get_vertices()), graph(std::move(g)) {}
+
+    void add_edge(int u, int v, W weight) {
+        // Extender un grafo ya construido: recuperar sus aristas
+        if (!dirty && graph) {
+            for (int x = 0; x < graph->get_vertices(); ++x) {
+                for (auto e = graph->edge_begin(x); e < graph->edge_end(x); ++e) {
+                    edges.push_back({x, graph->target(e), graph->weight(e)});
+                }
+            }
+        }
+        edges.push_back({u, v, weight});
+        dirty = true;
+    }
+
+    // Grafo actual (se construye si hay aristas pendientes)
+    const std::shared_ptr<const G>& shared() {
+        if (dirty || !graph) {
+            graph = std::make_shared<const G>(G::from_edges(n, edges));
+            edges.clear();
+            edges.shrink_to_fit();
+            dirty = false;
+        }
+        return graph;
+    }
+
+    const G& get() { return *shared(); }
+
+    // Grafo ya construido (solo válido después de get()/shared())
+    const G& built() const { return *graph; }
+
+    // Aristas (pendientes incluidas), sin construir el grafo
+    long long edge_count() const {
+        return dirty || !graph ? (long long)edges.size() : (long long)graph->get_edges_count();
+    }
+
+    void clear() {
+        edges.clear();
+        graph.reset();
+        dirty = false;
+    }
+};
+
+#endif // CSR_GRAPH_HPP
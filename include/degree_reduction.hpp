@@ -0,0 +1,201 @@
+#ifndef DEGREE_REDUCTION_HPP
+#define DEGREE_REDUCTION_HPP
+
+#include "csr_graph.hpp"
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <utility>
+
+// =====================================================
+// Transformación a grado constante
+//
+// Las cotas de BMSSP suponen grado de entrada y salida
+// constante; los grafos de densidad alta tienen grado
+// ~V/2. Cada vértice con más de max_degree aristas de
+// entrada o de salida se reemplaza por un ciclo de peso 0
+// de m = max(grado de entrada, grado de salida) vértices
+// (gadget). La posición j del ciclo recibe la j-ésima
+// arista entrante y emite la j-ésima saliente, así cada
+// vértice del gadget tiene grado de entrada y de salida
+// a lo sumo 2.
+//
+// La posición 0 conserva el ID original y las demás se
+// numeran a partir de V, de modo que todos los vértices
+// originales siguen existiendo. Como el ciclo tiene peso
+// 0, las m posiciones tienen la misma distancia. dist y
+// pred se traducen de vuelta con remap.
+// =====================================================
+template<typename W, typename VId = int, typename EId = long long>
+class DegreeReduction {
+public:
+    using Graph = CSRGraph<W, VId, EId>;
+
+private:
+    std::shared_ptr<const Graph> graph;  // grafo transformado
+    std::vector<int> owner;   // owner[nuevo] = vértice original
+    int n;                    // vértices originales
+    long long original_edges;
+    int split_count = 0;      // vértices reemplazados por un ciclo
+
+public:
+    DegreeReduction(const Graph& original, int max_degree = 2)
+        : n(original.get_vertices()), original_edges(original.get_edges_count()) {
+        max_degree = std::max(1, max_degree);
+
+        std::vector<EId> in_degree(n, 0);
+        for (EId e = 0; e < original_edges; ++e) {
+            in_degree[original.target(e)]++;
+        }
+
+        // slots[v] = tamaño del ciclo (1 si v no se parte);
+        // first[v] = ID de la posición 1 del ciclo de v
+        std::vector<EId> slots(n, 1);
+        std::vector<int> first(n, -1);
+        int total = n;
+        for (int v = 0; v < n; ++v) {
+            EId out = original.degree(v);
+            if (out > max_degree || in_degree[v] > max_degree) {
+                slots[v] = std::max(out, in_degree[v]);
+                first[v] = total;
+                total += (int)(slots[v] - 1);
+                split_count++;
+            }
+        }
+
+        auto node = [&](int v, EId slot) {
+            return slot == 0 ? v : first[v] + (int)(slot - 1);
+        };
+
+        owner.resize(total);
+        for (int v = 0; v < n; ++v) {
+            owner[v] = v;
+            for (EId j = 1; j < slots[v]; ++j) owner[node(v, j)] = v;
+        }
+
+        // Posición de entrada de cada arista: las entrantes de v
+        // ocupan sus posiciones en el orden del CSR
+        std::vector<EId> filled(n, 0);
+        std::vector<int> head(original_edges);
+        for (int u = 0; u < n; ++u) {
+            for (EId e = original.edge_begin(u); e < original.edge_end(u); ++e) {
+                int v = original.target(e);
+                head[e] = slots[v] == 1 ? v : node(v, filled[v]++);
+            }
+        }
+
+        // Grado de salida de cada vértice nuevo
+        std::vector<EId> offsets(total + 1, 0);
+        for (int v = 0; v < n; ++v) {
+            if (slots[v] == 1) {
+                offsets[v + 1] = original.degree(v);
+                continue;
+            }
+            EId out = original.degree(v);
+            for (EId j = 0; j < slots[v]; ++j) {
+                offsets[node(v, j) + 1] = 1 + (j < out ? 1 : 0);
+            }
+        }
+        for (int x = 0; x < total; ++x) {
+            offsets[x + 1] += offsets[x];
+        }
+
+        std::vector<VId> targets(offsets[total]);
+        std::vector<W> weights(offsets[total]);
+        for (int v = 0; v < n; ++v) {
+            EId begin = original.edge_begin(v);
+            if (slots[v] == 1) {
+                EId pos = offsets[v];
+                for (EId e = begin; e < original.edge_end(v); ++e, ++pos) {
+                    targets[pos] = static_cast<VId>(head[e]);
+                    weights[pos] = original.weight(e);
+                }
+                continue;
+            }
+
+            EId out = original.degree(v);
+            for (EId j = 0; j < slots[v]; ++j) {
+                EId pos = offsets[node(v, j)];
+                targets[pos] = static_cast<VId>(node(v, (j + 1) % slots[v]));
+                weights[pos] = W(0);
+                if (j < out) {
+                    targets[pos + 1] = static_cast<VId>(head[begin + j]);
+                    weights[pos + 1] = original.weight(begin + j);
+                }
+            }
+        }
+
+        graph = std::make_shared<const Graph>(Graph::from_arrays(
+            total, std::move(offsets), std::move(targets), std::move(weights)));
+    }
+
+    // Getters
+    const std::shared_ptr<const Graph>& get_graph() const { return graph; }
+    int get_original_vertices() const { return n; }
+    int get_split_vertices() const { return split_count; }
+    int to_new(int v) const { return v; }
+    int to_old(int x) const { return x < 0 ? x : owner[x]; }
+
+    // Factor de crecimiento en vértices y aristas
+    double vertex_blowup() const {
+        return n > 0 ? (double)graph->get_vertices() / n : 1.0;
+    }
+    double edge_blowup() const {
+        return original_edges > 0 ? (double)graph->get_edges_count() / original_edges : 1.0;
+    }
+
+    // Traducir dist/pred del grafo transformado a los vértices
+    // originales. El predecesor de v es el dueño del primer
+    // vértice fuera de su gadget en el camino hacia v
+    template<typename T>
+    std::pair<std::vector<T>, std::vector<int>>
+    remap(const std::vector<T>& dist, const std::vector<int>& pred) const {
+        std::vector<T> d(dist.begin(), dist.begin() + (dist.empty() ? 0 : n));
+        std::vector<int> p(pred.empty() ? 0 : n);
+        for (int v = 0; v < (int)p.size(); ++v) {
+            int x = v;
+            int y = pred[x];
+            while (y >= 0 && y != x && owner[y] == v) {
+                x = y;
+                y = pred[x];
+            }
+            // BMSSP marca el origen como su propio predecesor
+            p[v] = y == x ? v : to_old(y);
+        }
+        return {d, p};
+    }
+};
+
+// =====================================================
+// Adaptador: ejecuta un algoritmo sobre el grafo de grado
+// constante y devuelve dist/pred de los vértices originales
+// =====================================================
+template<typename Engine>
+class DegreeReducedEngine {
+public:
+    using T = typename Engine::distance_type;
+    using Graph = typename Engine::graph_type;
+    using Reduction = DegreeReduction<typename Graph::weight_type,
+                                      typename Graph::vertex_type,
+                                      typename Graph::edge_type>;
+
+private:
+    const Reduction& reduction;
+    Engine engine;
+
+public:
+    template<typename... Args>
+    explicit DegreeReducedEngine(const Reduction& red, Args&&... args)
+        : reduction(red), engine(red.get_graph(), std::forward<Args>(args)...) {}
+
+    template<typename... Args>
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Args&&... args) {
+        auto result = engine.execute(reduction.to_new(source), std::forward<Args>(args)...);
+        return reduction.remap(result.first, result.second);
+    }
+
+    Engine& get_engine() { return engine; }
+};
+
+#endif // DEGREE_REDUCTION_HPP
@@ -0,0 +1,405 @@
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "workspace.hpp"
+#include "weight_stats.hpp"
+#include "thread_barrier.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <cmath>
+#include <type_traits>
+
+// =====================================================
+// Delta-stepping paralelo (Meyer y Sanders)
+//
+// Las distancias tentativas se agrupan en buckets de ancho
+// delta. Las aristas se separan en livianas (w <= delta) y
+// pesadas. Para el bucket i no vacío:
+//   1. se relajan en paralelo las aristas livianas de sus
+//      vértices, repitiendo mientras el bucket i se vuelva
+//      a llenar (mínimo atómico sobre dist)
+//   2. se relajan una vez las aristas pesadas de todos los
+//      vértices que pasaron por el bucket i
+// Un solo hilo coordina entre fases (arma la frontera y
+// reparte los vértices insertados en cada hilo); las
+// relajaciones se reparten en bloques con un contador
+// atómico. Los buckets son circulares: ningún vértice
+// queda a más de max_w / delta + 1 buckets del actual.
+//
+// Requiere pesos no negativos.
+// =====================================================
+template<typename T, typename G = CSRGraph<T>>
+class DeltaStepping {
+public:
+    using graph_type = G;
+    using distance_type = T;
+
+    // Vértices de la frontera que toma un hilo por vez
+    static constexpr int CHUNK = 64;
+
+private:
+    using EId = typename G::edge_type;
+    using W = typename G::weight_type;
+
+    int n;
+    std::shared_ptr<const G> graph;  // grafo CSR compartido (solo lectura)
+    int threads;
+    T delta;
+
+    // Aristas de cada vértice reordenadas: livianas en
+    // [offsets[u], split[u]) y pesadas en [split[u], offsets[u + 1])
+    std::vector<EId> split;
+    std::vector<typename G::vertex_type> targets;
+    std::vector<W> weights;
+    T max_weight = 0;
+
+    std::unique_ptr<std::atomic<T>[]> dist;
+    std::unique_ptr<std::atomic<int>[]> pred;
+    SSSPWorkspace<T> own;   // resultados de execute(source)
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    // Estado de una consulta, reservado una vez en init y reutilizado:
+    // execute solo reinicia los vértices alcanzados por la anterior
+    std::vector<std::vector<int>> buckets;   // circulares
+    std::vector<int> frontier;           // vértices a relajar en la fase
+    std::vector<int> settled;            // vértices del bucket actual (R)
+    std::vector<int> reached;            // alcanzados (cada uno pasa una vez por R)
+    std::vector<long long> stamp;        // último bucket en que v entró a R
+    std::vector<long long> seen;         // última fase en que v entró a la frontera
+    long long current = 0, phase = 0;
+    bool heavy = false, done = false;
+    std::atomic<std::size_t> cursor{0};
+
+    // Inserciones de cada hilo (se reparten tras cada fase)
+    std::vector<std::vector<int>> inserted;
+    std::vector<long long> relaxations;
+
+    // Equipo de hilos creado en init y reutilizado entre consultas:
+    // cada execute abre con start y cierra con finish; dentro,
+    // barrier separa las fases
+    std::vector<std::thread> team;
+    std::unique_ptr<ThreadBarrier> start, finish, barrier;
+    int source = 0;
+    bool stop = false;
+
+    // dist[v] = min(dist[v], d); true si mejoró
+    bool atomic_min(int v, T d) {
+        T old = dist[v].load(std::memory_order_relaxed);
+        while (d < old) {
+            if (dist[v].compare_exchange_weak(old, d, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void partition_edges() {
+        const G& g = *graph;
+        split.assign(n, 0);
+        targets.resize(g.get_edges_count());
+        weights.resize(g.get_edges_count());
+
+        max_weight = 0;
+        for (int u = 0; u < n; ++u) {
+            EId light = g.edge_begin(u);
+            EId heavy = g.edge_end(u);
+            for (EId e = g.edge_begin(u); e < g.edge_end(u); ++e) {
+                T w = static_cast<T>(g.weight(e));
+                max_weight = std::max(max_weight, w);
+                EId pos = w <= delta ? light++ : --heavy;
+                targets[pos] = g.get_targets()[e];
+                weights[pos] = g.weight(e);
+            }
+            split[u] = light;
+        }
+    }
+
+    void init() {
+        partition_edges();
+        dist.reset(new std::atomic<T>[n]);
+        pred.reset(new std::atomic<int>[n]);
+        for (int v = 0; v < n; ++v) {
+            dist[v].store(INF, std::memory_order_relaxed);
+            pred[v].store(-1, std::memory_order_relaxed);
+        }
+
+        buckets.resize((std::size_t)(max_weight / delta) + 2);
+        frontier.reserve(n);
+        settled.reserve(n);
+        reached.reserve(n);
+        stamp.assign(n, -1);
+        seen.assign(n, -1);
+        inserted.resize(threads);
+        relaxations.assign(threads, 0);
+
+        barrier.reset(new ThreadBarrier(threads));
+        if (threads > 1) {
+            start.reset(new ThreadBarrier(threads));
+            finish.reset(new ThreadBarrier(threads));
+            for (int id = 1; id < threads; ++id) {
+                team.emplace_back([this, id]() {
+                    while (true) {
+                        start->wait();
+                        if (stop) return;
+                        work(id);
+                        finish->wait();
+                    }
+                });
+            }
+        }
+    }
+
+    // Armar la siguiente frontera (un solo hilo, entre barreras)
+    void next_phase() {
+        const std::size_t B = buckets.size();
+        for (auto& list : inserted) {
+            for (int v : list) {
+                T d = dist[v].load(std::memory_order_relaxed);
+                buckets[(std::size_t)(d / delta) % B].push_back(v);
+            }
+            list.clear();
+        }
+
+        while (true) {
+            frontier.clear();
+            phase++;
+
+            if (!heavy) {
+                // Vértices vigentes del bucket actual (sin duplicados)
+                auto& bucket = buckets[(std::size_t)current % B];
+                for (int v : bucket) {
+                    T d = dist[v].load(std::memory_order_relaxed);
+                    if ((long long)(d / delta) != current || seen[v] == phase) continue;
+                    seen[v] = phase;
+                    frontier.push_back(v);
+                    if (stamp[v] != current) {
+                        stamp[v] = current;
+                        settled.push_back(v);
+                        reached.push_back(v);
+                    }
+                }
+                bucket.clear();
+                if (!frontier.empty()) return;
+
+                // Bucket agotado: relajar las pesadas de R
+                heavy = true;
+                frontier.swap(settled);
+                settled.clear();
+                if (!frontier.empty()) return;
+            }
+
+            // Siguiente bucket no vacío
+            heavy = false;
+            std::size_t k = 1;
+            while (k <= B && buckets[(std::size_t)(current + k) % B].empty()) ++k;
+            if (k > B) {
+                done = true;
+                return;
+            }
+            current += k;
+        }
+    }
+
+    void relax(int id) {
+        auto& out = inserted[id];
+        long long count = 0;
+        while (true) {
+            std::size_t begin = cursor.fetch_add(CHUNK, std::memory_order_relaxed);
+            if (begin >= frontier.size()) break;
+            std::size_t end = std::min(frontier.size(), begin + CHUNK);
+
+            for (std::size_t i = begin; i < end; ++i) {
+                int u = frontier[i];
+                T du = dist[u].load(std::memory_order_relaxed);
+                EId from = heavy ? split[u] : graph->edge_begin(u);
+                EId to = heavy ? graph->edge_end(u) : split[u];
+                for (EId e = from; e < to; ++e) {
+                    int v = targets[e];
+                    T nd = du + static_cast<T>(weights[e]);
+                    count++;
+                    if (atomic_min(v, nd)) out.push_back(v);
+                }
+            }
+        }
+        relaxations[id] += count;
+    }
+
+    // Predecesores: BFS desde source sobre las aristas ajustadas
+    // dist[u] + w == dist[v], por niveles. Cada vértice se reclama
+    // una sola vez (CAS desde -1), así pred es un árbol aun con
+    // ciclos de peso cero
+    void tight_level(int id) {
+        auto& out = inserted[id];
+        while (true) {
+            std::size_t begin = cursor.fetch_add(CHUNK, std::memory_order_relaxed);
+            if (begin >= frontier.size()) break;
+            std::size_t end = std::min(frontier.size(), begin + CHUNK);
+
+            for (std::size_t i = begin; i < end; ++i) {
+                int u = frontier[i];
+                T du = dist[u].load(std::memory_order_relaxed);
+                for (EId e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+                    int v = targets[e];
+                    if (v == source || du + static_cast<T>(weights[e]) !=
+                                       dist[v].load(std::memory_order_relaxed)) continue;
+                    int expected = -1;
+                    if (pred[v].compare_exchange_strong(expected, u, std::memory_order_relaxed))
+                        out.push_back(v);
+                }
+            }
+        }
+    }
+
+    // Siguiente nivel del BFS (un solo hilo, entre barreras)
+    void next_level() {
+        frontier.clear();
+        for (auto& list : inserted) {
+            frontier.insert(frontier.end(), list.begin(), list.end());
+            list.clear();
+        }
+        cursor.store(0, std::memory_order_relaxed);
+    }
+
+    // Fases hasta vaciar los buckets y después el BFS de predecesores
+    void work(int id) {
+        while (true) {
+            if (id == 0) {
+                next_phase();
+                cursor.store(0, std::memory_order_relaxed);
+            }
+            barrier->wait();
+            if (done) break;
+            relax(id);
+            barrier->wait();
+        }
+
+        if (id == 0) {
+            frontier.assign(1, source);
+            cursor.store(0, std::memory_order_relaxed);
+        }
+        barrier->wait();
+        while (!frontier.empty()) {
+            tight_level(id);
+            barrier->wait();
+            if (id == 0) next_level();
+            barrier->wait();
+        }
+    }
+
+public:
+    // delta <= 0: se elige con auto_delta a partir de los pesos
+    DeltaStepping(std::shared_ptr<const G> g, int num_threads = 0, T delta_ = T())
+        : n(g->get_vertices()), graph(std::move(g)), threads(num_threads), delta(delta_) {
+        if (threads <= 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        if (delta <= T()) {
+            delta = auto_delta(graph->weight_stats());
+        }
+        init();
+    }
+
+    // El equipo guarda this: ni copias ni movimientos
+    DeltaStepping(const DeltaStepping&) = delete;
+    DeltaStepping& operator=(const DeltaStepping&) = delete;
+
+    ~DeltaStepping() {
+        if (team.empty()) return;
+        stop = true;
+        start->wait();
+        for (auto& th : team) th.join();
+    }
+
+    // Delta ~ peso máximo / grado promedio (Meyer y Sanders): con
+    // grado alto los buckets angostos evitan relajaciones de más.
+    // Nunca menor que el peso mínimo ni que 1 para pesos enteros.
+    static T auto_delta(const WeightStats& ws) {
+        double d = ws.max / std::max(1.0, ws.avg_degree());
+        d = std::max(d, ws.min);
+        if (std::is_integral<T>::value) d = std::max(1.0, std::floor(d));
+        return d > 0.0 ? static_cast<T>(d) : T(1);
+    }
+
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return {{}, {}};
+        }
+
+        execute(source, own, M);
+        return {own.dist, own.pred};
+    }
+
+    // Resultado en un workspace del llamador
+    void execute(int source_, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        if (source_ < 0 || source_ >= n) {
+            return;
+        }
+
+        // Reinicio O(alcanzados en la consulta anterior)
+        for (int v : reached) {
+            dist[v].store(INF, std::memory_order_relaxed);
+            pred[v].store(-1, std::memory_order_relaxed);
+            stamp[v] = -1;
+            seen[v] = -1;
+        }
+        if (M) M->assign(4 * reached.size());
+        reached.clear();
+
+        source = source_;
+        dist[source].store(0, std::memory_order_relaxed);
+        buckets[0].push_back(source);
+        current = 0;
+        phase = 0;
+        heavy = false;
+        done = false;
+        std::fill(relaxations.begin(), relaxations.end(), 0);
+
+        if (threads == 1) {
+            work(0);
+        }
+        else {
+            start->wait();
+            work(0);
+            finish->wait();
+        }
+
+        if (M) {
+            for (long long r : relaxations) M->arithmetic(r);
+            M->compare(phase);
+        }
+
+        // Copiar al workspace (reached es exactamente lo tocado)
+        ws.reset(n, INF);
+        for (int v : reached) {
+            ws.update(v, dist[v].load(std::memory_order_relaxed),
+                      pred[v].load(std::memory_order_relaxed));
+            if (M) M->settle();
+        }
+    }
+
+    // Obtener distancia a un destino (última ejecución con execute(source))
+    T get_distance(int destination) const {
+        if (destination >= 0 && destination < n && !own.dist.empty()) {
+            return own.dist[destination];
+        }
+        return INF;
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    int get_threads() const { return threads; }
+    T get_delta() const { return delta; }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // DELTA_STEPPING_HPP
@@ -2,54 +2,53 @@
 #define DIJKSTRA_HPP
 
 #include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "priority_queues.hpp"
+#include "workspace.hpp"
 
 #include <vector>
-#include <queue>
 #include <limits>
 #include <algorithm>
+#include <memory>
 
-template<typename T>
+// Queue: política de cola de prioridad (ver priority_queues.hpp)
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
 class Dijkstra {
+public:
+    using graph_type = G;
+    using distance_type = T;
+    using queue_type = Queue<T>;
+
 private:
-    struct Edge {
-        int to;
-        T weight;
-        Edge(int t, T w) : to(t), weight(w) {}
-    };
-    
     int n;  // número de vértices
-    std::vector<std::vector<Edge>> adj;  // lista de adyacencia
-    std::vector<T> dist;
-    std::vector<int> pred;
+    CSRGraphBuilder<G> graph;  // grafo CSR compartido (solo lectura)
+    SSSPWorkspace<T> own;      // workspace de execute/query sin workspace externo
+    Queue<T> pq;
+    bool queue_ready = false;  // pq inicializada para el grafo actual
     
     static constexpr T INF = std::numeric_limits<T>::max();
 
-public:
-    Dijkstra(int vertices) : n(vertices), adj(vertices) {}
-    
-    // Agregar arista dirigida
-    void add_edge(int u, int v, T weight) {
-        if (u >= 0 && u < n && v >= 0 && v < n) {
-            adj[u].emplace_back(v, weight);
-        }
-    }
-    
-    // Ejecutar Dijkstra desde un nodo fuente
-    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* M = nullptr) {
-        if (source < 0 || source >= n) {
-            return {{}, {}};
+    // Búsqueda desde source; si target >= 0 termina al extraerlo
+    void run(int source, int target, SSSPWorkspace<T>& ws, Metrics* M) {
+        const G& g = graph.get();
+        if (!queue_ready) {
+            // Colas de buckets (Dial) se dimensionan con el peso máximo
+            pq.init(n, Queue<T>::uses_max_weight
+                           ? static_cast<T>(g.weight_range().second) : T());
+            queue_ready = true;
         }
 
-        dist.assign(n, INF);
-        pred.assign(n, -1);
-        if (M) M->assign(2 * n);   // inicialización de vectores
+        // Reinicio O(tocados) salvo la primera vez
+        if (M) M->assign(2 * (ws.dist.size() == (std::size_t)n ? ws.touched_count() : n));
+        ws.reset(n, INF);
+        const std::vector<T>& dist = ws.dist;
 
-        dist[source] = 0;
+        ws.update(source, 0, -1);
         if (M) M->assign();
 
-        using pii = std::pair<T, int>;
-        std::priority_queue<pii, std::vector<pii>, std::greater<pii>> pq;
-        pq.push({0, source});
+        pq.clear();
+        pq.push(source, 0);
         if (M) {
             M->call();     // push
             M->assign(2);
@@ -58,8 +57,7 @@ public:
         while (!pq.empty()) {
             if (M) M->compare();
 
-            auto [d, u] = pq.top();
-            pq.pop();
+            auto [d, u] = pq.pop();
             if (M) {
                 M->call(2);    // top + pop
                 M->assign(2);
@@ -72,12 +70,19 @@ public:
                 }
                 continue;
             }
+            if (M) M->settle();
 
-            for (const auto& edge : adj[u]) {
+            // Destino extraído: su distancia ya es definitiva
+            if (u == target) {
+                if (M) M->compare();
+                break;
+            }
+
+            for (auto e = g.edge_begin(u); e < g.edge_end(u); ++e) {
                 if (M) M->access(2);
 
-                int v = edge.to;
-                T new_dist = dist[u] + edge.weight;
+                int v = g.target(e);
+                T new_dist = dist[u] + static_cast<T>(g.weight(e));
                 if (M) {
                     M->assign(2);
                     M->arithmetic();
@@ -91,9 +96,8 @@ public:
                         M->access(2);
                     }
 
-                    dist[v] = new_dist;
-                    pred[v] = u;
-                    pq.push({new_dist, v});
+                    ws.update(v, new_dist, u);
+                    pq.push(v, new_dist);
                     if (M) {
                         M->call();
                         M->assign(2);
@@ -101,17 +105,70 @@ public:
                 }
             }
         }
+    }
 
-        return {dist, pred};
+public:
+    Dijkstra(int vertices) : n(vertices), graph(vertices) {}
+
+    // Usar un grafo CSR ya construido, compartido con otros algoritmos
+    Dijkstra(std::shared_ptr<const G> g)
+        : n(g->get_vertices()), graph(std::move(g)) {}
+    
+    // Agregar arista dirigida
+    void add_edge(int u, int v, T weight) {
+        if (u >= 0 && u < n && v >= 0 && v < n) {
+            graph.add_edge(u, v, weight);
+            queue_ready = false;
+        }
+    }
+    
+    // Ejecutar Dijkstra desde un nodo fuente
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return {{}, {}};
+        }
+
+        run(source, -1, own, M);
+        return {own.dist, own.pred};
+    }
+
+    // Igual que execute, pero sobre un workspace del llamador: no hay
+    // copia de resultados (leerlos con ws.distances()/predecessors())
+    void execute(int source, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return;
+        }
+        run(source, -1, ws, M);
+    }
+
+    // Consulta punto a punto: se detiene al extraer el destino.
+    // Solo dist[target] y el camino hasta target son definitivos;
+    // get_distance/get_shortest_path(target) sirven a continuación
+    T query(int source, int target, Metrics* M = nullptr) {
+        if (source < 0 || source >= n || target < 0 || target >= n) {
+            return INF;
+        }
+
+        run(source, target, own, M);
+        return own.dist[target];
+    }
+
+    T query(int source, int target, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        if (source < 0 || source >= n || target < 0 || target >= n) {
+            return INF;
+        }
+
+        run(source, target, ws, M);
+        return ws.dist[target];
     }
     
     // Reconstruir el camino más corto hasta un destino
     std::vector<int> get_shortest_path(int destination) const {
-        if (destination < 0 || destination >= n || pred.empty()) {
+        if (destination < 0 || destination >= n || own.pred.empty()) {
             return {};
         }
         
-        if (dist[destination] == INF) {
+        if (own.dist[destination] == INF) {
             return {};  // No hay camino
         }
         
@@ -120,7 +177,7 @@ public:
         
         while (current != -1) {
             path.push_back(current);
-            current = pred[current];
+            current = own.pred[current];
         }
         
         std::reverse(path.begin(), path.end());
@@ -130,31 +187,33 @@ public:
     // Verificar si hay camino a un destino
     bool has_path(int destination) const {
         return destination >= 0 && destination < n && 
-               !dist.empty() && dist[destination] != INF;
+               !own.dist.empty() && own.dist[destination] != INF;
     }
     
     // Obtener distancia a un destino
     T get_distance(int destination) const {
-        if (destination >= 0 && destination < n && !dist.empty()) {
-            return dist[destination];
+        if (destination >= 0 && destination < n && !own.dist.empty()) {
+            return own.dist[destination];
         }
         return INF;
     }
     
     // Limpiar el grafo
     void clear() {
-        for (auto& v : adj) {
-            v.clear();
-        }
-        dist.clear();
-        pred.clear();
+        graph.clear();
+        queue_ready = false;
+        own = SSSPWorkspace<T>();
     }
     
     // Getters
     int get_vertices() const { return n; }
-    const std::vector<T>& get_distances() const { return dist; }
-    const std::vector<int>& get_predecessors() const { return pred; }
+    std::shared_ptr<const G> get_graph() { return graph.shared(); }
+    const std::vector<T>& get_distances() const { return own.dist; }
+    const std::vector<int>& get_predecessors() const { return own.pred; }
     
+    // Nombre de la cola de prioridad usada
+    static const char* queue_name() { return Queue<T>::name(); }
+
     // Valor infinito público para comparaciones
     static T infinity() { return INF; }
 };
@@ -0,0 +1,741 @@
+#ifndef DUAN_BMSSP_HPP
+#define DUAN_BMSSP_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "priority_queues.hpp"
+#include "workspace.hpp"
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <memory>
+
+namespace spp {
+
+// =====================================================
+// Etiqueta de un vértice: (distancia, aristas, vértice)
+//
+// Duan et al. suponen longitudes de camino distintas. El
+// orden lexicográfico lo garantiza: a igual distancia
+// desempata la cantidad de aristas (que crece en 1 por
+// arista, así el predecesor siempre es menor aunque haya
+// pesos 0) y después el número de vértice.
+// =====================================================
+template<typename T>
+struct PathLabel {
+    T dist;
+    int hops;
+    int v;
+
+    bool operator<(const PathLabel& o) const {
+        if (dist != o.dist) return dist < o.dist;
+        if (hops != o.hops) return hops < o.hops;
+        return v < o.v;
+    }
+};
+
+// =====================================================
+// Estructura D del Lema 3.3 (lista de bloques)
+//
+// Guarda pares (vértice, clave) con a lo sumo una entrada
+// por vértice (la de menor clave). Dos secuencias de
+// bloques de a lo sumo M elementos:
+//   D0: bloques de batch_prepend, el primero es el menor
+//   D1: bloques de insert, ordenados por cota superior
+//       en un árbol (std::multimap)
+// insert parte un bloque por la mediana al superar M;
+// pull junta los primeros bloques de cada secuencia hasta
+// tener M elementos y se queda con los M menores.
+// =====================================================
+template<typename Key>
+class BlockList {
+public:
+    struct Item {
+        Key key;
+        int v;
+    };
+
+private:
+    static constexpr int ABSENT = -1;
+    static constexpr int PENDING = -2;   // en la lista de batch_prepend en curso
+
+    struct Block {
+        std::vector<Item> items;
+        Key upper;   // solo para bloques de D1
+    };
+
+    std::vector<Block> pool;
+    std::vector<int> free_blocks;
+    std::deque<int> prepended;          // D0
+    std::multimap<Key, int> inserted;   // D1: cota superior -> bloque
+
+    std::vector<int> block_of;   // bloque de cada vértice (ABSENT si no está)
+    std::vector<int> index_of;   // posición dentro del bloque
+    std::vector<Item> scratch;
+
+    std::size_t M = 1;
+    std::size_t count = 0;
+    Key bound{};
+
+    static bool by_key(const Item& a, const Item& b) { return a.key < b.key; }
+
+    int new_block() {
+        if (!free_blocks.empty()) {
+            int b = free_blocks.back();
+            free_blocks.pop_back();
+            return b;
+        }
+        pool.emplace_back();
+        return (int)pool.size() - 1;
+    }
+
+    void release(int b) {
+        for (const Item& it : pool[b].items) block_of[it.v] = ABSENT;
+        count -= pool[b].items.size();
+        pool[b].items.clear();
+        free_blocks.push_back(b);
+    }
+
+    void place(int b, const Item& item) {
+        block_of[item.v] = b;
+        index_of[item.v] = (int)pool[b].items.size();
+        pool[b].items.push_back(item);
+        count++;
+    }
+
+    void remove(int v) {
+        auto& items = pool[block_of[v]].items;
+        int i = index_of[v];
+        items[i] = items.back();
+        index_of[items[i].v] = i;
+        items.pop_back();
+        block_of[v] = ABSENT;
+        count--;
+    }
+
+    // Partir un bloque de D1 por la mediana: la mitad menor
+    // pasa a un bloque nuevo con cota = su máximo
+    void split(typename std::multimap<Key, int>::iterator it) {
+        int b = it->second;
+        auto& items = pool[b].items;
+        std::size_t mid = items.size() / 2;
+        std::nth_element(items.begin(), items.begin() + mid, items.end(), by_key);
+
+        int lower = new_block();
+        auto& src = pool[b].items;   // pool pudo crecer
+        Key upper = src[0].key;
+        for (std::size_t i = 0; i < mid; ++i) {
+            if (upper < src[i].key) upper = src[i].key;
+            pool[lower].items.push_back(src[i]);
+        }
+        src.erase(src.begin(), src.begin() + mid);
+
+        for (std::size_t i = 0; i < src.size(); ++i) index_of[src[i].v] = (int)i;
+        auto& low = pool[lower].items;
+        for (std::size_t i = 0; i < low.size(); ++i) {
+            block_of[low[i].v] = lower;
+            index_of[low[i].v] = (int)i;
+        }
+        pool[lower].upper = upper;
+        inserted.emplace(upper, lower);
+    }
+
+    // Cortar a[lo, hi) en tramos ordenados de a lo sumo cap
+    // elementos (medianas sucesivas, sin ordenar del todo)
+    void chunk(std::vector<Item>& a, std::size_t lo, std::size_t hi, std::size_t cap,
+               std::vector<std::pair<std::size_t, std::size_t>>& out) {
+        if (hi - lo <= cap) {
+            out.push_back({lo, hi});
+            return;
+        }
+        std::size_t mid = lo + (hi - lo) / 2;
+        std::nth_element(a.begin() + lo, a.begin() + mid, a.begin() + hi, by_key);
+        chunk(a, lo, mid, cap, out);
+        chunk(a, mid, hi, cap, out);
+    }
+
+public:
+    void init(int n) {
+        block_of.assign(n, ABSENT);
+        index_of.assign(n, 0);
+    }
+
+    // Vaciar y fijar el tamaño de bloque M y la cota superior B
+    void reset(std::size_t block_size, Key upper_bound) {
+        for (int b : prepended) release(b);
+        for (auto& [upper, b] : inserted) release(b);
+        prepended.clear();
+        inserted.clear();
+        M = std::max<std::size_t>(1, block_size);
+        bound = upper_bound;
+        count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    // Insertar (v, key) o bajar la clave de v; key < B
+    void insert(int v, const Key& key) {
+        if (block_of[v] >= 0) {
+            if (!(key < pool[block_of[v]].items[index_of[v]].key)) return;
+            remove(v);
+        }
+
+        auto it = inserted.lower_bound(key);
+        if (it == inserted.end()) {
+            int b = new_block();
+            pool[b].upper = bound;
+            it = inserted.emplace(bound, b);
+        }
+        place(it->second, {key, v});
+        if (pool[it->second].items.size() > M) split(it);
+    }
+
+    // Agregar al frente claves menores que todas las de D
+    void batch_prepend(const std::vector<Item>& list) {
+        scratch.clear();
+        for (const Item& item : list) {
+            int v = item.v;
+            if (block_of[v] == PENDING) {
+                Item& prev = scratch[index_of[v]];
+                if (item.key < prev.key) prev.key = item.key;
+                continue;
+            }
+            if (block_of[v] >= 0) {
+                if (!(item.key < pool[block_of[v]].items[index_of[v]].key)) continue;
+                remove(v);
+            }
+            block_of[v] = PENDING;
+            index_of[v] = (int)scratch.size();
+            scratch.push_back(item);
+        }
+        if (scratch.empty()) return;
+
+        std::vector<std::pair<std::size_t, std::size_t>> ranges;
+        if (scratch.size() <= M) {
+            ranges.push_back({0, scratch.size()});
+        }
+        else {
+            chunk(scratch, 0, scratch.size(), (M + 1) / 2, ranges);
+        }
+
+        for (auto r = ranges.rbegin(); r != ranges.rend(); ++r) {
+            int b = new_block();
+            for (std::size_t i = r->first; i < r->second; ++i) place(b, scratch[i]);
+            prepended.push_front(b);
+        }
+    }
+
+    // Extraer las (a lo sumo) M claves menores en out. Devuelve
+    // una cota x: claves extraídas < x <= claves restantes
+    // (B si D quedó vacía)
+    Key pull(std::vector<int>& out) {
+        out.clear();
+        scratch.clear();
+
+        std::size_t taken = 0;
+        for (std::size_t j = 0; j < prepended.size() && taken < M; ++j) {
+            for (const Item& it : pool[prepended[j]].items) scratch.push_back(it);
+            taken += pool[prepended[j]].items.size();
+        }
+        taken = 0;
+        for (auto it = inserted.begin(); it != inserted.end() && taken < M; ++it) {
+            for (const Item& item : pool[it->second].items) scratch.push_back(item);
+            taken += pool[it->second].items.size();
+        }
+
+        if (scratch.size() > M) {
+            std::nth_element(scratch.begin(), scratch.begin() + M, scratch.end(), by_key);
+            scratch.resize(M);
+        }
+        for (const Item& it : scratch) {
+            remove(it.v);
+            out.push_back(it.v);
+        }
+
+        // Descartar bloques vacíos del frente de cada secuencia
+        while (!prepended.empty() && pool[prepended.front()].items.empty()) {
+            free_blocks.push_back(prepended.front());
+            prepended.pop_front();
+        }
+        while (!inserted.empty() && pool[inserted.begin()->second].items.empty()) {
+            free_blocks.push_back(inserted.begin()->second);
+            inserted.erase(inserted.begin());
+        }
+
+        if (count == 0) return bound;
+
+        // El mínimo restante está en el primer bloque de D0 o de D1
+        bool found = false;
+        Key x = bound;
+        auto scan = [&](int b) {
+            for (const Item& it : pool[b].items) {
+                if (!found || it.key < x) x = it.key;
+                found = true;
+            }
+        };
+        if (!prepended.empty()) scan(prepended.front());
+        if (!inserted.empty()) scan(inserted.begin()->second);
+        return x;
+    }
+};
+
+// =====================================================
+// BMSSP de Duan, Mao, Mao, Shu y Yin ("Breaking the
+// Sorting Barrier for Directed Single-Source Shortest
+// Paths", 2025), sin corrección final
+//
+// Parámetros: k = log^{1/3} n, t = log^{2/3} n y
+// L = ceil(log n / t) niveles. BMSSP(l, B, S):
+//   - l = 0: Dijkstra acotado desde S hasta k + 1 vértices
+//   - FindPivots: k rondas de Bellman-Ford desde S; si
+//     se alcanzan más de k|S| vértices todo S es pivote,
+//     si no, solo las raíces con >= k vértices en el
+//     bosque de aristas ajustadas
+//   - la lista de bloques D (M = 2^{(l-1)t}) entrega
+//     grupos de pivotes a BMSSP(l-1, ...) hasta que D se
+//     vacía o se completan k 2^{lt} vértices
+// Cada llamada devuelve B' y los vértices U con d < B'
+// ya completos. El nivel superior completa todo el grafo.
+//
+// El contador de la cola (Queue) solo se usa en el caso
+// base; las claves son PathLabel, así que las colas de
+// buckets no sirven.
+// =====================================================
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
+class duan_bmssp {
+public:
+    using graph_type = G;
+    using distance_type = T;
+    using label_type = PathLabel<T>;
+    using queue_type = Queue<label_type>;
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+private:
+    using Item = typename BlockList<label_type>::Item;
+
+    int n;
+    CSRGraphBuilder<G> graph;   // grafo CSR compartido (solo lectura)
+    const G* csr = nullptr;     // grafo de la ejecución actual
+
+    SSSPWorkspace<T> own;            // workspace de execute(source)
+    SSSPWorkspace<T>* ws = nullptr;  // workspace de la ejecución actual
+    std::vector<int> hops;           // aristas del camino actual a cada vértice
+
+    int k;        // rondas de FindPivots y tamaño del caso base
+    int t;        // cada nivel multiplica por 2^t el tamaño de bloque
+    int levels;   // L = ceil(log n / t)
+
+    std::vector<BlockList<label_type>> blocks;   // una D por nivel
+    std::vector<std::vector<int>> in_u;          // marca de U por nivel
+    std::vector<int> epoch_level;
+    Queue<label_type> pq;                        // caso base
+
+    // Marcas por época (evitan borrar arreglos de tamaño n)
+    std::vector<int> mark_w, mark_round, mark_u;
+    int epoch_w = 0, epoch_round = 0, epoch_u = 0;
+
+    // Completos de la ejecución actual: entraron a algún U, su
+    // etiqueta ya es definitiva. Sin la marca, una entrada vieja
+    // de D los devuelve y el caso base vuelve a asentar todo su
+    // subárbol con relajaciones de igual etiqueta
+    std::vector<int> mark_done;
+    int epoch_done = 0;
+    std::vector<int> parent, first_child, next_sibling;
+
+    Metrics* M = nullptr;
+
+    label_type label(int v) const { return {ws->dist[v], hops[v], v}; }
+
+    bool complete(int v) const { return mark_done[v] == epoch_done; }
+
+    // (d, h) <= (dist[v], hops[v]): las relajaciones usan <= como
+    // en el artículo, para que un nivel superior vuelva a
+    // recorrer aristas ya relajadas por uno inferior. Un vértice
+    // completo no mejora
+    bool improves(T d, int h, int v) const {
+        if (complete(v)) return false;
+        const T dv = ws->dist[v];
+        return d < dv || (d == dv && h <= hops[v]);
+    }
+
+    void relax(int v, T d, int h, int u) {
+        ws->update(v, d, u);
+        hops[v] = h;
+        if (M) {
+            M->access(2);
+            M->assign(3);
+        }
+    }
+
+    static long long pow2(long long e) {
+        return e >= 62 ? std::numeric_limits<long long>::max() : (1LL << e);
+    }
+
+    void init() {
+        double lg = std::log2(std::max(2, n));
+        k = std::max(1, (int)std::floor(std::cbrt(lg)));
+        t = std::max(1, (int)std::floor(std::pow(lg, 2.0 / 3.0)));
+        levels = n <= 1 ? 0 : (int)std::ceil(lg / t);
+
+        blocks.resize(levels + 1);
+        for (auto& d : blocks) d.init(n);
+        in_u.assign(levels + 1, std::vector<int>(n, 0));
+        epoch_level.assign(levels + 1, 0);
+        pq.init(n);
+
+        hops.assign(n, 0);
+        mark_w.assign(n, 0);
+        mark_round.assign(n, 0);
+        mark_u.assign(n, 0);
+        mark_done.assign(n, 0);
+        parent.assign(n, -1);
+        first_child.assign(n, -1);
+        next_sibling.assign(n, -1);
+    }
+
+    // =====================================================
+    // Caso base: Dijkstra acotado por B desde S hasta
+    // completar k + 1 vértices
+    // =====================================================
+    label_type base_case(const label_type& B, const std::vector<int>& S,
+                         std::vector<int>& U) {
+        const std::vector<T>& dist = ws->dist;
+        U.clear();
+        epoch_u++;
+
+        pq.clear();
+        for (int x : S) pq.push(x, label(x));
+        if (M) M->call(S.size());
+
+        while (!pq.empty() && (int)U.size() < k + 1) {
+            auto [key, u] = pq.pop();
+            if (M) {
+                M->call();
+                M->compare(2);
+            }
+            if (mark_u[u] == epoch_u || label(u) < key || key < label(u)) continue;
+
+            mark_u[u] = epoch_u;
+            U.push_back(u);
+            if (M) M->settle();
+
+            for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                int v = csr->target(e);
+                T nd = dist[u] + static_cast<T>(csr->weight(e));
+                int nh = hops[u] + 1;
+                if (M) {
+                    M->access(2);
+                    M->arithmetic(2);
+                    M->compare(2);
+                }
+                if (improves(nd, nh, v) && label_type{nd, nh, v} < B) {
+                    relax(v, nd, nh, u);
+                    pq.push(v, label(v));
+                    if (M) M->call();
+                }
+            }
+        }
+
+        if ((int)U.size() <= k) {
+            for (int u : U) mark_done[u] = epoch_done;
+            return B;
+        }
+
+        // Éxito parcial: B' = mayor etiqueta completada
+        label_type bound = label(U[0]);
+        for (int u : U) {
+            if (bound < label(u)) bound = label(u);
+        }
+        U.erase(std::remove_if(U.begin(), U.end(),
+                               [&](int u) { return !(label(u) < bound); }),
+                U.end());
+        for (int u : U) mark_done[u] = epoch_done;
+        if (M) M->compare(2 * U.size());
+        return bound;
+    }
+
+    // =====================================================
+    // FindPivots: k rondas de relajación desde S. Devuelve
+    // los pivotes P y deja en W los vértices alcanzados
+    // =====================================================
+    void find_pivots(const label_type& B, const std::vector<int>& S,
+                     std::vector<int>& P, std::vector<int>& W) {
+        const std::vector<T>& dist = ws->dist;
+        epoch_w++;
+        W = S;
+        for (int x : S) mark_w[x] = epoch_w;
+
+        std::vector<int> layer = S, next;
+        const std::size_t limit = (std::size_t)k * S.size();
+
+        for (int i = 0; i < k; ++i) {
+            epoch_round++;
+            next.clear();
+
+            for (int u : layer) {
+                for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                    int v = csr->target(e);
+                    T nd = dist[u] + static_cast<T>(csr->weight(e));
+                    int nh = hops[u] + 1;
+                    if (M) {
+                        M->access(2);
+                        M->arithmetic(2);
+                        M->compare();
+                    }
+                    if (!improves(nd, nh, v)) continue;
+
+                    relax(v, nd, nh, u);
+                    if (label_type{nd, nh, v} < B && mark_round[v] != epoch_round) {
+                        mark_round[v] = epoch_round;
+                        next.push_back(v);
+                    }
+                }
+            }
+
+            for (int v : next) {
+                if (mark_w[v] != epoch_w) {
+                    mark_w[v] = epoch_w;
+                    W.push_back(v);
+                }
+            }
+
+            // Demasiados vértices: todo S es pivote
+            if (W.size() > limit) {
+                P = S;
+                return;
+            }
+            layer.swap(next);
+        }
+
+        // Bosque de aristas ajustadas dentro de W. Un vértice de S
+        // también puede colgar de otro (entonces no es raíz)
+        for (int u : W) {
+            parent[u] = -1;
+            first_child[u] = -1;
+        }
+        for (int u : W) {
+            for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                int v = csr->target(e);
+                if (M) M->access(2);
+                if (mark_w[v] != epoch_w || parent[v] != -1) {
+                    continue;
+                }
+                if (dist[u] + static_cast<T>(csr->weight(e)) == dist[v] &&
+                    hops[u] + 1 == hops[v]) {
+                    parent[v] = u;
+                    next_sibling[v] = first_child[u];
+                    first_child[u] = v;
+                    if (M) M->assign(3);
+                }
+            }
+        }
+
+        // Pivotes: raíces de árboles con al menos k vértices
+        P.clear();
+        std::vector<int> stack;
+        for (int x : S) {
+            if (parent[x] != -1) continue;
+            int size = 0;
+            stack.assign(1, x);
+            while (!stack.empty() && size < k) {
+                int u = stack.back();
+                stack.pop_back();
+                size++;
+                for (int c = first_child[u]; c != -1; c = next_sibling[c]) stack.push_back(c);
+            }
+            if (M) M->compare();
+            if (size >= k) P.push_back(x);
+        }
+    }
+
+    // =====================================================
+    // BMSSP(l, B, S): devuelve B' y deja en U los vértices
+    // completados con etiqueta < B'
+    // =====================================================
+    label_type rec(int l, const label_type& B, const std::vector<int>& S,
+                   std::vector<int>& U) {
+        if (M) M->call();
+        if (l == 0) {
+            return base_case(B, S, U);
+        }
+
+        std::vector<int> P, W;
+        find_pivots(B, S, P, W);
+
+        BlockList<label_type>& D = blocks[l];
+        D.reset((std::size_t)std::min<long long>(pow2((long long)(l - 1) * t), n), B);
+
+        label_type last = B;   // B'_i de la última iteración
+        for (int x : P) {
+            D.insert(x, label(x));
+            if (label(x) < last) last = label(x);
+        }
+
+        // U es un conjunto: D puede conservar una entrada vieja de un
+        // vértice que otra subllamada ya completó, y volver a
+        // entregarlo. Sin la marca, |U| contaría repetidos
+        std::vector<int>& mark = in_u[l];
+        const int epoch = ++epoch_level[l];
+        auto add = [&](int v) {
+            if (mark[v] != epoch) {
+                mark[v] = epoch;
+                mark_done[v] = epoch_done;
+                U.push_back(v);
+            }
+        };
+
+        U.clear();
+        const long long work = (long long)k * std::min<long long>(
+            pow2((long long)l * t), std::numeric_limits<long long>::max() / k);
+
+        std::vector<int> Si, Ui;
+        std::vector<Item> K;
+        while ((long long)U.size() < work && !D.empty()) {
+            label_type Bi = D.pull(Si);
+
+            // Entradas viejas de vértices que ya completó otra subllamada
+            Si.erase(std::remove_if(Si.begin(), Si.end(),
+                                    [&](int x) { return complete(x); }),
+                     Si.end());
+            if (M) M->compare(Si.size());
+            if (Si.empty()) {
+                last = Bi;
+                continue;
+            }
+
+            label_type Bpi = rec(l - 1, Bi, Si, Ui);
+            for (int u : Ui) add(u);
+            last = Bpi;
+
+            const std::vector<T>& dist = ws->dist;
+            K.clear();
+            for (int u : Ui) {
+                for (auto e = csr->edge_begin(u); e < csr->edge_end(u); ++e) {
+                    int v = csr->target(e);
+                    T nd = dist[u] + static_cast<T>(csr->weight(e));
+                    int nh = hops[u] + 1;
+                    if (M) {
+                        M->access(2);
+                        M->arithmetic(2);
+                        M->compare();
+                    }
+                    if (!improves(nd, nh, v)) continue;
+
+                    relax(v, nd, nh, u);
+                    label_type key{nd, nh, v};
+                    if (!(key < Bi) && key < B) {
+                        D.insert(v, key);
+                    }
+                    else if (!(key < Bpi) && key < Bi) {
+                        K.push_back({key, v});
+                    }
+                    if (M) M->compare(2);
+                }
+            }
+            for (int x : Si) {
+                label_type key = label(x);
+                if (!complete(x) && !(key < Bpi) && key < Bi) K.push_back({key, x});
+            }
+            D.batch_prepend(K);
+        }
+
+        label_type bound = last < B ? last : B;
+
+        // U ∪ {x ∈ W : etiqueta < B'}
+        for (int x : W) {
+            if (label(x) < bound) add(x);
+        }
+        if (M) M->compare(W.size());
+        return bound;
+    }
+
+public:
+    duan_bmssp(int vertices) : n(vertices), graph(vertices) {
+        init();
+    }
+
+    // Usar un grafo CSR ya construido, compartido con otros algoritmos
+    duan_bmssp(std::shared_ptr<const G> g)
+        : n(g->get_vertices()), graph(std::move(g)) {
+        init();
+    }
+
+    // Agregar arista dirigida
+    void add_edge(int u, int v, T weight) {
+        if (u >= 0 && u < n && v >= 0 && v < n) {
+            graph.add_edge(u, v, weight);
+        }
+    }
+
+    // Nombre de la cola de prioridad del caso base
+    static const char* queue_name() { return Queue<label_type>::name(); }
+
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* metrics = nullptr) {
+        if (source < 0 || source >= n) {
+            return {{}, {}};
+        }
+
+        execute(source, own, metrics);
+        return {own.dist, own.pred};
+    }
+
+    // Igual que execute, pero sobre un workspace del llamador: no hay
+    // copia de resultados (leerlos con ws.distances()/predecessors())
+    void execute(int source, SSSPWorkspace<T>& workspace, Metrics* metrics = nullptr) {
+        if (source < 0 || source >= n) {
+            return;
+        }
+
+        csr = &graph.get();
+        ws = &workspace;
+        M = metrics;
+
+        // Reinicio O(tocados) salvo la primera vez
+        if (M) M->assign(2 * (ws->dist.size() == (std::size_t)n ? ws->touched_count() : n));
+        ws->reset(n, INF);
+
+        ws->update(source, 0, -1);
+        hops[source] = 0;
+        epoch_done++;
+
+        const label_type top{INF, std::numeric_limits<int>::max(),
+                             std::numeric_limits<int>::max()};
+        std::vector<int> U;
+        rec(levels, top, {source}, U);
+
+        M = nullptr;
+    }
+
+    // Obtener distancia a un destino (última ejecución con execute(source))
+    T get_distance(int destination) const {
+        if (destination >= 0 && destination < n && !own.dist.empty()) {
+            return own.dist[destination];
+        }
+        return INF;
+    }
+
+    // Reconstruir el camino más corto hasta un destino
+    std::vector<int> get_shortest_path(int destination) const {
+        return own.get_shortest_path(destination);
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    int get_k() const { return k; }
+    int get_t() const { return t; }
+    int get_levels() const { return levels; }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+} // namespace spp
+
+#endif // DUAN_BMSSP_HPP
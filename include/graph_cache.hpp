@@ -0,0 +1,317 @@
+#ifndef GRAPH_CACHE_HPP
+#define GRAPH_CACHE_HPP
+
+#include "csr_graph.hpp"
+#include "graph_loader.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// =====================================================
+// Caché binaria de grafos CSR (formato versionado)
+//
+// Diseño del archivo (orden de bytes nativo, little-endian):
+//   [0,  128)  cabecera (CacheHeader)
+//   offsets    (n + 1) x EId
+//   targets    m x VId
+//   weights    m x W
+// Cada sección comienza alineada a 64 bytes, de modo que
+// el archivo se puede mapear con mmap y servir los arreglos
+// directamente como vistas del CSRGraph, sin copiarlos.
+// La cabecera registra el tamaño de cada tipo: una caché
+// escrita con otros tipos compactos se rechaza.
+//
+// Versiones: 1 = offsets int64 / targets int32 fijos,
+//            2 = tipos de vértice/offset/peso configurables.
+// =====================================================
+template<typename W, typename VId = int, typename EId = long long>
+class GraphCache {
+public:
+    using Graph = CSRGraph<W, VId, EId>;
+
+    static constexpr std::uint32_t VERSION = 2;
+
+private:
+    struct CacheHeader {
+        char magic[8];              // "CSRGRAPH"
+        std::uint32_t version;
+        std::uint32_t weight_size;  // sizeof(W)
+        std::uint32_t weight_kind;  // ver weight_kind()
+        std::uint32_t vertex_size;  // sizeof(VId)
+        std::uint32_t offset_size;  // sizeof(EId)
+        std::uint32_t reserved;
+        std::int64_t n;
+        std::int64_t m;
+        std::uint64_t offsets_pos;
+        std::uint64_t targets_pos;
+        std::uint64_t weights_pos;
+    };
+    static_assert(sizeof(CacheHeader) <= 128, "cabecera demasiado grande");
+
+    static constexpr std::uint64_t ALIGN = 64;
+    static constexpr std::uint64_t HEADER_SIZE = 128;
+
+    static std::uint64_t align_up(std::uint64_t x) {
+        return (x + ALIGN - 1) / ALIGN * ALIGN;
+    }
+
+    // 0: entero con signo, 1: entero sin signo, 2: punto flotante
+    static std::uint32_t weight_kind() {
+        if (std::is_floating_point<W>::value) return 2;
+        return std::is_signed<W>::value ? 0 : 1;
+    }
+
+    // Tipo usado al parsear el .gr (pesos angostos se leen como int)
+    using ParseT = typename std::conditional<
+        std::is_integral<W>::value && (sizeof(W) < sizeof(int)), int, W>::type;
+
+    // Rellenar con ceros desde pos hasta target
+    static void write_padding(std::ofstream& out, std::uint64_t pos, std::uint64_t target) {
+        static const char zeros[ALIGN] = {};
+        while (pos < target) {
+            std::uint64_t chunk = std::min(target - pos, ALIGN);
+            out.write(zeros, chunk);
+            pos += chunk;
+        }
+    }
+
+    // count elementos de elem bytes desde pos entran en size bytes
+    // (sin desbordar la aritmética con cabeceras corruptas)
+    static bool fits(std::uint64_t pos, std::uint64_t count, std::uint64_t elem,
+                     std::uint64_t size) {
+        return pos <= size && count <= (size - pos) / elem;
+    }
+
+    // Offsets no decrecientes y destinos en [0, n): recorre todo
+    // el archivo, así que solo se usa al convertir (o con verify)
+    static bool valid_csr(std::int64_t n, std::int64_t m, const EId* offsets,
+                          const VId* targets) {
+        for (std::int64_t u = 0; u < n; ++u) {
+            if (static_cast<std::int64_t>(offsets[u + 1]) < static_cast<std::int64_t>(offsets[u])) {
+                return false;
+            }
+        }
+        for (std::int64_t e = 0; e < m; ++e) {
+            std::int64_t v = static_cast<std::int64_t>(targets[e]);
+            if (v < 0 || v >= n) return false;
+        }
+        return true;
+    }
+
+public:
+    // Posición de cada sección para n vértices y m aristas
+    struct Layout {
+        std::uint64_t offsets_pos;
+        std::uint64_t targets_pos;
+        std::uint64_t weights_pos;
+    };
+
+    static Layout layout(std::int64_t n, std::int64_t m) {
+        Layout l;
+        l.offsets_pos = HEADER_SIZE;
+        l.targets_pos = align_up(l.offsets_pos + (n + 1) * sizeof(EId));
+        l.weights_pos = align_up(l.targets_pos + m * sizeof(VId));
+        return l;
+    }
+
+    // Escribir la cabecera (y el relleno hasta los offsets). Sirve
+    // también para escribir la caché por partes: después cada
+    // sección va en su posición de layout(n, m), en cualquier orden
+    static void write_header(std::ofstream& out, std::int64_t n, std::int64_t m) {
+        Layout l = layout(n, m);
+
+        CacheHeader h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, "CSRGRAPH", 8);
+        h.version = VERSION;
+        h.weight_size = sizeof(W);
+        h.weight_kind = weight_kind();
+        h.vertex_size = sizeof(VId);
+        h.offset_size = sizeof(EId);
+        h.n = n;
+        h.m = m;
+        h.offsets_pos = l.offsets_pos;
+        h.targets_pos = l.targets_pos;
+        h.weights_pos = l.weights_pos;
+
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        write_padding(out, sizeof(h), h.offsets_pos);
+    }
+
+    // Ruta de la caché asociada a un archivo .gr (graph_100_low.gr -> graph_100_low.csr)
+    static std::string cache_path(const std::string& gr_file) {
+        return std::filesystem::path(gr_file).replace_extension(".csr").string();
+    }
+
+    // Escribir el CSR en disco: primero en <filename>.tmp y después se
+    // renombra, así un proceso que lee la caché nunca la ve a medias
+    static bool save(const Graph& g, const std::string& filename) {
+        std::string tmp = filename + ".tmp";
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Error: no se pudo crear " << tmp << "\n";
+            return false;
+        }
+
+        std::int64_t n = g.get_vertices();
+        std::int64_t m = g.get_edges_count();
+
+        write_header(out, n, m);
+        Layout h = layout(n, m);
+
+        auto offsets = g.get_offsets();
+        out.write(reinterpret_cast<const char*>(offsets.data()),
+                  offsets.size() * sizeof(EId));
+        write_padding(out, h.offsets_pos + offsets.size() * sizeof(EId), h.targets_pos);
+
+        auto targets = g.get_targets();
+        out.write(reinterpret_cast<const char*>(targets.data()),
+                  targets.size() * sizeof(VId));
+        write_padding(out, h.targets_pos + targets.size() * sizeof(VId), h.weights_pos);
+
+        auto weights = g.get_weights();
+        out.write(reinterpret_cast<const char*>(weights.data()),
+                  weights.size() * sizeof(W));
+
+        out.close();
+        if (!out) {
+            std::cerr << "Error: escritura incompleta en " << tmp << "\n";
+            std::remove(tmp.c_str());
+            return false;
+        }
+        if (std::rename(tmp.c_str(), filename.c_str()) != 0) {
+            std::cerr << "Error: no se pudo renombrar " << tmp << " a " << filename << "\n";
+            std::remove(tmp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // Mapear la caché con mmap y devolver un CSR de vistas (sin copias).
+    // Devuelve nullptr si el archivo no existe o no es compatible.
+    // Se validan la cabecera, los tamaños de sección y offsets[0] /
+    // offsets[n]; verify agrega el recorrido O(n + m) de offsets y
+    // destinos (toca todas las páginas del mapeo)
+    static std::shared_ptr<const Graph> load(const std::string& filename, bool verify = false) {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || (std::uint64_t)st.st_size < sizeof(CacheHeader)) {
+            ::close(fd);
+            std::cerr << "Advertencia: caché inválida " << filename << "\n";
+            return nullptr;
+        }
+
+        std::size_t size = st.st_size;
+        void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            std::cerr << "Error: mmap falló para " << filename << "\n";
+            return nullptr;
+        }
+
+        // El mapeo se libera cuando se destruye el último grafo que lo usa
+        std::shared_ptr<const void> mapping(addr, [size](const void* p) {
+            ::munmap(const_cast<void*>(p), size);
+        });
+
+        CacheHeader h;
+        std::memcpy(&h, addr, sizeof(h));
+
+        if (std::memcmp(h.magic, "CSRGRAPH", 8) != 0 || h.version != VERSION) {
+            std::cerr << "Advertencia: versión de caché no soportada en "
+                      << filename << "\n";
+            return nullptr;
+        }
+        if (h.weight_size != sizeof(W) || h.weight_kind != weight_kind() ||
+            h.vertex_size != sizeof(VId) || h.offset_size != sizeof(EId)) {
+            std::cerr << "Advertencia: tipos compactos incompatibles en "
+                      << filename << "\n";
+            return nullptr;
+        }
+        if (h.n < 0 || h.m < 0 || h.n > INT_MAX) {
+            std::cerr << "Advertencia: tamaño inválido en la caché " << filename << "\n";
+            return nullptr;
+        }
+        if (h.offsets_pos % ALIGN != 0 || h.targets_pos % ALIGN != 0 ||
+            h.weights_pos % ALIGN != 0 ||
+            !fits(h.offsets_pos, (std::uint64_t)h.n + 1, sizeof(EId), size) ||
+            !fits(h.targets_pos, (std::uint64_t)h.m, sizeof(VId), size) ||
+            !fits(h.weights_pos, (std::uint64_t)h.m, sizeof(W), size)) {
+            std::cerr << "Advertencia: caché truncada " << filename << "\n";
+            return nullptr;
+        }
+
+        const char* base = static_cast<const char*>(addr);
+        const EId* offsets = reinterpret_cast<const EId*>(base + h.offsets_pos);
+        const VId* targets = reinterpret_cast<const VId*>(base + h.targets_pos);
+        if (static_cast<std::int64_t>(offsets[0]) != 0 ||
+            static_cast<std::int64_t>(offsets[h.n]) != h.m ||
+            (verify && !valid_csr(h.n, h.m, offsets, targets))) {
+            std::cerr << "Advertencia: offsets o destinos inválidos en la caché "
+                      << filename << "\n";
+            return nullptr;
+        }
+
+        return std::make_shared<const Graph>(Graph::from_views(
+            (int)h.n, offsets, targets,
+            reinterpret_cast<const W*>(base + h.weights_pos),
+            std::move(mapping)));
+    }
+
+    // Cargar un .gr usando la caché binaria: si existe una caché más
+    // reciente que el .gr se mapea directamente; si no, se parsea el .gr
+    // una vez, se escribe la caché y se mapea el archivo recién creado.
+    static std::shared_ptr<const Graph> load_or_convert(const std::string& gr_file) {
+        namespace fs = std::filesystem;
+        std::string cache_file = cache_path(gr_file);
+
+        std::error_code ec;
+        if (fs::exists(cache_file, ec) &&
+            fs::last_write_time(cache_file, ec) >= fs::last_write_time(gr_file, ec)) {
+            auto g = load(cache_file);
+            if (g) {
+                std::cout << "Caché binaria: " << cache_file << " ("
+                          << g->get_vertices() << " vértices, "
+                          << g->get_edges_count() << " aristas)\n";
+                return g;
+            }
+        }
+
+        std::shared_ptr<const Graph> parsed;
+        {
+            GraphLoader<ParseT> loader;
+            if (!loader.load_from_file_parallel(gr_file)) {
+                return nullptr;
+            }
+            parsed = std::make_shared<const Graph>(
+                Graph::from_edges(loader.get_vertices(), loader.get_edges()));
+        }
+
+        if (!save(*parsed, cache_file)) {
+            return parsed;  // sin caché, pero el grafo en memoria es válido
+        }
+
+        auto mapped = load(cache_file, true);
+        return mapped ? mapped : parsed;
+    }
+};
+
+#endif // GRAPH_CACHE_HPP
@@ -37,7 +37,7 @@ public:
         n = vertices;
         edges.clear();
 
-        int E = n;
+        long long E = n;
         generate_connected_base();
 
         add_random_edges(E - (n - 1));
@@ -51,7 +51,7 @@ public:
         n = vertices;
         edges.clear();
 
-        int E = static_cast<int>(n * std::log2(n));
+        long long E = static_cast<long long>(n * std::log2(n));
         generate_connected_base();
 
         add_random_edges(E - (n - 1));
@@ -65,13 +65,14 @@ public:
         n = vertices;
         edges.clear();
 
-        int E = (n * n) / 2;
-        std::set<std::pair<int,int>> used;
+        // Los pares se recorren una sola vez: no hay repetidos que
+        // descartar. Para grafos grandes, ver StreamingGraphGenerator
+        long long E = (long long)n * n / 2;
+        edges.reserve(E);
 
-        for (int u = 0; u < n; ++u) {
-            for (int v = 0; v < n; ++v) {
-                if (u != v && used.size() < (size_t)E) {
-                    used.insert({u, v});
+        for (int u = 0; u < n && (long long)edges.size() < E; ++u) {
+            for (int v = 0; v < n && (long long)edges.size() < E; ++v) {
+                if (u != v) {
                     edges.push_back({u, v, random_weight()});
                 }
             }
@@ -122,7 +123,7 @@ private:
     }
 
     // Agregar aristas aleatorias sin duplicar
-    void add_random_edges(int extra) {
+    void add_random_edges(long long extra) {
         std::set<std::pair<int,int>> used;
         for (auto& e : edges)
             used.insert({e.u, e.v});
@@ -1,11 +1,23 @@
 #ifndef GRAPH_LOADER_HPP
 #define GRAPH_LOADER_HPP
 
+#include "weight_stats.hpp"
+
 #include <vector>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <string>
+#include <charconv>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 template<typename T>
 class GraphLoader {
@@ -20,9 +32,10 @@ private:
     int n;  // número de vértices
     int m;  // número de aristas
     std::vector<Edge> edges;
+    double parse_mb_per_s;  // throughput del último parseo paralelo
 
 public:
-    GraphLoader() : n(0), m(0) {}
+    GraphLoader() : n(0), m(0), parse_mb_per_s(0.0) {}
 
     // Cargar desde archivo formato DIMACS .gr
     bool load_from_file(const std::string& filename) {
@@ -101,6 +114,160 @@ public:
         return true;
     }
     
+    // Cargar desde archivo formato DIMACS .gr (versión paralela)
+    // El archivo se mapea en memoria, se divide en bloques alineados a
+    // fin de línea y cada hilo parsea sus líneas 'a u v w' con
+    // std::from_chars en un buffer propio; luego se concatenan en orden.
+    // Mantiene las validaciones y advertencias de load_from_file.
+    bool load_from_file_parallel(const std::string& filename, int threads = 0) {
+        auto start = std::chrono::steady_clock::now();
+
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "Error: no se pudo abrir " << filename << "\n";
+            return false;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            std::cerr << "Error: no se pudo abrir " << filename << "\n";
+            return false;
+        }
+
+        edges.clear();
+        n = 0;
+        m = 0;
+        parse_mb_per_s = 0.0;
+
+        std::size_t size = st.st_size;
+        const char* data = nullptr;
+        if (size > 0) {
+            void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                std::cerr << "Error: mmap falló para " << filename << "\n";
+                return false;
+            }
+            ::madvise(addr, size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(addr);
+        }
+        ::close(fd);
+
+        const char* end = data + size;
+        const char* p = data;
+        bool header_found = false;
+        bool ok = true;
+
+        // Header secuencial: comentarios y 'p sp n m'
+        while (p < end && !header_found) {
+            const char* eol = find_eol(p, end);
+            const char* q = skip_spaces(p, eol);
+
+            if (q == eol || *q == 'c') {
+                // Línea vacía o comentario, ignorar
+            }
+            else if (*q == 'p') {
+                q = skip_spaces(q + 1, eol);
+                const char* f = q;
+                while (q < eol && *q != ' ' && *q != '\t') ++q;
+                std::string format(f, q);
+                q = parse_number(skip_spaces(q, eol), eol, n);
+                parse_number(skip_spaces(q, eol), eol, m);
+
+                if (format != "sp") {
+                    std::cerr << "Advertencia: formato esperado 'sp', encontrado '"
+                              << format << "'\n";
+                }
+
+                header_found = true;
+                std::cout << "Cargando grafo: " << n << " vértices, "
+                          << m << " aristas\n";
+            }
+            else if (*q == 'a') {
+                std::cerr << "Error: arista antes del header 'p'\n";
+                ok = false;
+                break;
+            }
+            else {
+                std::cerr << "Advertencia: línea desconocida '"
+                          << std::string(p, eol) << "'\n";
+            }
+            p = eol < end ? eol + 1 : end;
+        }
+
+        if (ok && header_found) {
+            if (threads <= 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            // Bloques alineados a fin de línea
+            std::size_t body = end - p;
+            std::vector<const char*> bounds(threads + 1, end);
+            bounds[0] = p;
+            for (int t = 1; t < threads; ++t) {
+                const char* b = std::max(bounds[t - 1], p + body * t / threads);
+                if (b > p && b < end && b[-1] != '\n') {
+                    b = find_eol(b, end);
+                    if (b < end) ++b;
+                }
+                bounds[t] = b;
+            }
+
+            std::vector<std::vector<Edge>> local(threads);
+            std::vector<std::vector<std::string>> warnings(threads);
+            std::vector<std::thread> workers;
+
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t]() {
+                    parse_chunk(bounds[t], bounds[t + 1], local[t], warnings[t]);
+                });
+            }
+            for (auto& w : workers) {
+                w.join();
+            }
+
+            // Advertencias en el orden del archivo
+            for (const auto& ws : warnings) {
+                for (const auto& w : ws) {
+                    std::cerr << w;
+                }
+            }
+
+            std::size_t total = 0;
+            for (const auto& l : local) {
+                total += l.size();
+            }
+            edges.reserve(std::max<std::size_t>(total, m));
+            for (auto& l : local) {
+                edges.insert(edges.end(), l.begin(), l.end());
+                std::vector<Edge>().swap(l);
+            }
+        }
+
+        if (data) {
+            ::munmap(const_cast<char*>(data), size);
+        }
+        if (!ok) {
+            return false;
+        }
+
+        if (edges.size() != m) {
+            std::cerr << "Advertencia: se esperaban " << m << " aristas, "
+                      << "se cargaron " << edges.size() << "\n";
+        }
+
+        double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        parse_mb_per_s = seconds > 0 ? (size / (1024.0 * 1024.0)) / seconds : 0.0;
+
+        std::cout << "Grafo cargado exitosamente: " << n << " vértices, "
+                  << edges.size() << " aristas\n";
+        std::cout << "Parseo paralelo (" << threads << " hilos): "
+                  << parse_mb_per_s << " MB/s\n";
+        return true;
+    }
+
     // Cargar desde formato simple (cada línea: u v weight)
     bool load_from_simple_format(const std::string& filename, int vertices) {
         std::ifstream file(filename);
@@ -169,27 +336,88 @@ public:
         }
         
         if (!edges.empty()) {
-            T min_w = edges[0].weight;
-            T max_w = edges[0].weight;
-            T sum_w = 0;
-            
-            for (const auto& e : edges) {
-                min_w = std::min(min_w, e.weight);
-                max_w = std::max(max_w, e.weight);
-                sum_w += e.weight;
-            }
-            
-            std::cout << "Peso mínimo: " << min_w << "\n";
-            std::cout << "Peso máximo: " << max_w << "\n";
-            std::cout << "Peso promedio: " << (sum_w / edges.size()) << "\n";
+            WeightStats ws = get_weight_stats();
+            std::cout << "Peso mínimo: " << ws.min << "\n";
+            std::cout << "Peso máximo: " << ws.max << "\n";
+            std::cout << "Peso promedio: " << ws.mean << "\n";
         }
         std::cout << "==============================\n\n";
     }
     
+    // Distribución de pesos de las aristas cargadas
+    WeightStats get_weight_stats() const {
+        return WeightStats::collect(n, [&](auto&& add) {
+            for (const auto& e : edges) add(static_cast<double>(e.weight));
+        });
+    }
+
     // Getters
     int get_vertices() const { return n; }
     int get_edges_count() const { return edges.size(); }
     const std::vector<Edge>& get_edges() const { return edges; }
+    double get_parse_throughput() const { return parse_mb_per_s; }
+
+private:
+    static const char* find_eol(const char* p, const char* end) {
+        const void* nl = std::memchr(p, '\n', end - p);
+        return nl ? static_cast<const char*>(nl) : end;
+    }
+
+    static const char* skip_spaces(const char* p, const char* end) {
+        if (!p) return nullptr;
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+        return p;
+    }
+
+    // Devuelve la posición después del número, o nullptr si no hay número
+    template<typename N>
+    static const char* parse_number(const char* p, const char* end, N& out) {
+        if (!p) return nullptr;
+        auto res = std::from_chars(p, end, out);
+        return res.ec == std::errc() ? res.ptr : nullptr;
+    }
+
+    // Parsear las líneas de [begin, end) en un buffer propio del hilo
+    void parse_chunk(const char* begin, const char* end,
+                     std::vector<Edge>& out,
+                     std::vector<std::string>& warnings) const {
+        out.reserve((end - begin) / 12);
+
+        const char* p = begin;
+        while (p < end) {
+            const char* eol = find_eol(p, end);
+            const char* q = skip_spaces(p, eol);
+
+            if (q == eol || *q == 'c') {
+                // Línea vacía o comentario, ignorar
+            }
+            else if (*q == 'a') {
+                int u = 0, v = 0;
+                T weight{};
+                q = parse_number(skip_spaces(q + 1, eol), eol, u);
+                q = parse_number(skip_spaces(q, eol), eol, v);
+                q = parse_number(skip_spaces(q, eol), eol, weight);
+
+                if (!q) {
+                    warnings.push_back("Advertencia: arista mal formada '"
+                                       + std::string(p, eol) + "', ignorada\n");
+                }
+                else if (u < 0 || u >= n || v < 0 || v >= n) {
+                    warnings.push_back("Advertencia: arista fuera de rango ("
+                                       + std::to_string(u) + ", " + std::to_string(v)
+                                       + "), ignorada\n");
+                }
+                else {
+                    out.emplace_back(u, v, weight);
+                }
+            }
+            else {
+                warnings.push_back("Advertencia: línea desconocida '"
+                                   + std::string(p, eol) + "'\n");
+            }
+            p = eol < end ? eol + 1 : end;
+        }
+    }
 };
 
 #endif // GRAPH_LOADER_HPP
\ No newline at end of file
@@ -0,0 +1,126 @@
+#ifndef INTEGER_DIJKSTRA_HPP
+#define INTEGER_DIJKSTRA_HPP
+
+#include "dijkstra.hpp"
+#include "bucket_queues.hpp"
+#include "priority_queues.hpp"
+#include "metrics.hpp"
+
+#include <memory>
+#include <variant>
+#include <utility>
+#include <type_traits>
+
+// =====================================================
+// Dijkstra con selección automática de cola
+//
+// Con distancias y pesos enteros no negativos:
+//   - peso máximo <= DIAL_MAX_WEIGHT  -> Dial (buckets circulares)
+//   - peso máximo mayor               -> radix heap
+// En cualquier otro caso (pesos reales o negativos) se
+// usa el heap binario perezoso de siempre.
+// =====================================================
+enum class IntegerQueueKind { Dial, Radix, Heap };
+
+// Colas enteras disponibles según el tipo (con tipos no enteros
+// se reemplazan por el heap binario para poder instanciar)
+template<bool Integral>
+struct IntegerQueueSet {
+    template<typename K> using Dial = DialQueue<K>;
+    template<typename K> using Radix = RadixHeap<K>;
+};
+
+template<>
+struct IntegerQueueSet<false> {
+    template<typename K> using Dial = LazyBinaryHeap<K>;
+    template<typename K> using Radix = LazyBinaryHeap<K>;
+};
+
+template<typename T, typename G = CSRGraph<T>>
+class AutoDijkstra {
+public:
+    using graph_type = G;
+    using distance_type = T;
+
+    // Límite para Dial: C + 1 buckets y hasta C buckets vacíos por avance
+    static constexpr long long DIAL_MAX_WEIGHT = 1 << 12;
+
+private:
+    static constexpr bool integral =
+        std::is_integral<T>::value && std::is_integral<typename G::weight_type>::value;
+
+    using Queues = IntegerQueueSet<integral>;
+    using DialEngine = Dijkstra<T, G, Queues::template Dial>;
+    using RadixEngine = Dijkstra<T, G, Queues::template Radix>;
+    using HeapEngine = Dijkstra<T, G, LazyBinaryHeap>;
+
+    IntegerQueueKind chosen;
+    std::variant<DialEngine, RadixEngine, HeapEngine> engine;
+
+    static std::variant<DialEngine, RadixEngine, HeapEngine>
+    make_engine(IntegerQueueKind kind, std::shared_ptr<const G> g) {
+        switch (kind) {
+            case IntegerQueueKind::Dial:
+                return std::variant<DialEngine, RadixEngine, HeapEngine>(
+                    std::in_place_index<0>, std::move(g));
+            case IntegerQueueKind::Radix:
+                return std::variant<DialEngine, RadixEngine, HeapEngine>(
+                    std::in_place_index<1>, std::move(g));
+            default:
+                return std::variant<DialEngine, RadixEngine, HeapEngine>(
+                    std::in_place_index<2>, std::move(g));
+        }
+    }
+
+public:
+    explicit AutoDijkstra(std::shared_ptr<const G> g)
+        : chosen(choose(*g)), engine(make_engine(chosen, g)) {}
+
+    // Elegir la cola según el tipo y el rango de pesos del grafo
+    static IntegerQueueKind choose(const G& g) {
+        if (!integral) {
+            return IntegerQueueKind::Heap;
+        }
+        auto [lo, hi] = g.weight_range();
+        if (lo < 0) {
+            return IntegerQueueKind::Heap;
+        }
+        return (long long)hi <= DIAL_MAX_WEIGHT ? IntegerQueueKind::Dial
+                                                : IntegerQueueKind::Radix;
+    }
+
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* M = nullptr) {
+        return std::visit([&](auto& e) { return e.execute(source, M); }, engine);
+    }
+
+    void execute(int source, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        std::visit([&](auto& e) { e.execute(source, ws, M); }, engine);
+    }
+
+    T query(int source, int target, Metrics* M = nullptr) {
+        return std::visit([&](auto& e) { return e.query(source, target, M); }, engine);
+    }
+
+    T query(int source, int target, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        return std::visit([&](auto& e) { return e.query(source, target, ws, M); }, engine);
+    }
+
+    T get_distance(int destination) const {
+        return std::visit([&](const auto& e) { return e.get_distance(destination); }, engine);
+    }
+
+    std::vector<int> get_shortest_path(int destination) const {
+        return std::visit([&](const auto& e) { return e.get_shortest_path(destination); }, engine);
+    }
+
+    // Getters
+    IntegerQueueKind get_kind() const { return chosen; }
+
+    const char* queue_name() const {
+        return std::visit([](const auto& e) { return e.queue_name(); }, engine);
+    }
+
+    static T infinity() { return HeapEngine::infinity(); }
+};
+
+#endif // INTEGER_DIJKSTRA_HPP
@@ -0,0 +1,400 @@
+#ifndef JOHNSON_HPP
+#define JOHNSON_HPP
+
+#include "csr_graph.hpp"
+#include "bellman_ford.hpp"
+#include "dijkstra.hpp"
+#include "workspace.hpp"
+#include "metrics.hpp"
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// =====================================================
+// Matriz de distancias V x V en un archivo mapeado
+//
+// Diseño del archivo (orden de bytes nativo):
+//   [0, 64)   cabecera (MatrixHeader)
+//   [64, ...) teselas de tile x tile valores T
+// Las teselas se guardan por bandas de filas: la banda I
+// (filas I*tile .. I*tile + tile - 1) es contigua y dentro
+// de cada tesela los valores van por fila. V se redondea
+// hacia arriba a un múltiplo de tile; el relleno queda en
+// cero. Una banda terminada se puede bajar a disco y
+// soltar de memoria sin tocar las demás, así que la matriz
+// no necesita entrar en RAM.
+// =====================================================
+template<typename T>
+class TiledDistanceMatrix {
+private:
+    struct MatrixHeader {
+        char magic[8];              // "APSPTILE"
+        std::uint32_t value_size;   // sizeof(T)
+        std::uint32_t tile;
+        std::int64_t n;
+        std::uint64_t data_pos;
+        char reserved[32];
+    };
+    static_assert(sizeof(MatrixHeader) == 64, "la cabecera ocupa 64 bytes");
+
+    static constexpr std::uint64_t DATA_POS = sizeof(MatrixHeader);
+
+    int n = 0;
+    int tile = 1;
+    std::uint64_t tiles = 0;    // teselas por fila de teselas
+    std::size_t size = 0;       // bytes mapeados
+    void* addr = nullptr;
+    T* data = nullptr;
+
+    void unmap() {
+        if (addr) ::munmap(addr, size);
+        addr = nullptr;
+        data = nullptr;
+    }
+
+    bool map(int fd, int prot) {
+        addr = ::mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            addr = nullptr;
+            return false;
+        }
+        data = reinterpret_cast<T*>(static_cast<char*>(addr) + DATA_POS);
+        return true;
+    }
+
+    static std::size_t file_size(int vertices, int tile_size) {
+        std::uint64_t side = ((std::uint64_t)vertices + tile_size - 1) / tile_size * tile_size;
+        return DATA_POS + side * side * sizeof(T);
+    }
+
+public:
+    TiledDistanceMatrix() = default;
+    TiledDistanceMatrix(const TiledDistanceMatrix&) = delete;
+    TiledDistanceMatrix& operator=(const TiledDistanceMatrix&) = delete;
+    ~TiledDistanceMatrix() { unmap(); }
+
+    // Crear (o truncar) el archivo y mapearlo para escritura
+    bool create(const std::string& filename, int vertices, int tile_size) {
+        unmap();
+        n = vertices;
+        tile = std::max(1, tile_size);
+        tiles = ((std::uint64_t)n + tile - 1) / tile;
+        size = file_size(n, tile);
+
+        int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            std::cerr << "Error: no se pudo crear " << filename << "\n";
+            return false;
+        }
+        if (::ftruncate(fd, size) != 0 || !map(fd, PROT_READ | PROT_WRITE)) {
+            ::close(fd);
+            std::cerr << "Error: mmap falló para " << filename << "\n";
+            return false;
+        }
+        ::close(fd);
+
+        MatrixHeader h{};
+        std::memcpy(h.magic, "APSPTILE", 8);
+        h.value_size = sizeof(T);
+        h.tile = tile;
+        h.n = n;
+        h.data_pos = DATA_POS;
+        std::memcpy(addr, &h, sizeof(h));
+        return true;
+    }
+
+    // Mapear una matriz existente para lectura
+    bool open(const std::string& filename) {
+        unmap();
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        MatrixHeader h;
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || (std::uint64_t)st.st_size < sizeof(h) ||
+            ::pread(fd, &h, sizeof(h), 0) != (ssize_t)sizeof(h) ||
+            std::memcmp(h.magic, "APSPTILE", 8) != 0 || h.value_size != sizeof(T) ||
+            h.tile == 0 || (std::uint64_t)st.st_size < file_size(h.n, h.tile)) {
+            ::close(fd);
+            std::cerr << "Advertencia: matriz de distancias inválida " << filename << "\n";
+            return false;
+        }
+
+        n = (int)h.n;
+        tile = (int)h.tile;
+        tiles = ((std::uint64_t)n + tile - 1) / tile;
+        size = file_size(n, tile);
+        bool ok = map(fd, PROT_READ);
+        ::close(fd);
+        if (!ok) {
+            std::cerr << "Error: mmap falló para " << filename << "\n";
+        }
+        return ok;
+    }
+
+    // Posición de (s, t) en el arreglo de teselas
+    std::uint64_t index(int s, int t) const {
+        std::uint64_t band = s / tile, column = t / tile;
+        return ((band * tiles + column) * tile + s % tile) * tile + t % tile;
+    }
+
+    T at(int s, int t) const { return data[index(s, t)]; }
+    void set(int s, int t, T d) { data[index(s, t)] = d; }
+
+    // Bajar a disco la banda de filas de s y soltar sus páginas
+    // (la escritura sigue en segundo plano)
+    void release_band(int s) {
+        const std::size_t page = ::sysconf(_SC_PAGESIZE);
+        std::uint64_t band_bytes = tiles * tile * tile * sizeof(T);
+        std::uint64_t begin = DATA_POS + (std::uint64_t)(s / tile) * band_bytes;
+        std::uint64_t end = begin + band_bytes;
+
+        // Solo páginas completas de la banda: las de los bordes
+        // pueden ser compartidas con las bandas vecinas
+        begin = (begin + page - 1) / page * page;
+        end = end / page * page;
+        if (begin >= end) return;
+
+        char* base = static_cast<char*>(addr);
+        ::msync(base + begin, end - begin, MS_ASYNC);
+        ::madvise(base + begin, end - begin, MADV_DONTNEED);
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    int get_tile() const { return tile; }
+    bool is_open() const { return data != nullptr; }
+};
+
+// =====================================================
+// Johnson: distancias entre todos los pares con pesos
+// negativos (sin ciclos negativos)
+//
+// 1. Potenciales: Bellman-Ford una vez desde una súper
+//    fuente virtual (vértice V con aristas de peso 0 a
+//    todos); h[v] = dist(V, v) <= 0.
+// 2. Reponderación a un CSR compartido con pesos T:
+//    w'(u, v) = w + h[u] - h[v] >= 0 (no entra en W).
+// 3. Dijkstra desde cada vértice en paralelo: cada hilo
+//    tiene su motor y su workspace y toma la siguiente
+//    fuente de un contador atómico. La fila s se escribe
+//    des-reponderada, d(s, t) = d'(s, t) - h[s] + h[t], en
+//    la matriz por teselas; el hilo que completa una banda
+//    la baja a disco.
+//
+// Si hay un ciclo negativo, compute_potentials devuelve
+// false y el ciclo queda en get_negative_cycle().
+// =====================================================
+template<typename T, typename G = CSRGraph<T>,
+         template<typename> class Queue = LazyBinaryHeap>
+class Johnson {
+public:
+    using graph_type = G;
+    using distance_type = T;
+    using ReweightedGraph = CSRGraph<T, typename G::vertex_type, typename G::edge_type>;
+
+    // Estadísticas de la última corrida
+    struct Stats {
+        int threads = 0;
+        double potentials_ms = 0.0;   // Bellman-Ford desde la súper fuente
+        double reweight_ms = 0.0;
+        double elapsed_ms = 0.0;      // Dijkstra + escritura de la matriz (pared)
+        std::vector<std::size_t> per_thread;   // filas resueltas por hilo
+        std::vector<double> per_thread_ms;     // tiempo ocupado por hilo
+
+        double rows_per_second() const {
+            std::size_t rows = 0;
+            for (std::size_t r : per_thread) rows += r;
+            return elapsed_ms > 0.0 ? rows / (elapsed_ms / 1000.0) : 0.0;
+        }
+
+        double thread_rows_per_second(int id) const {
+            return per_thread_ms[id] > 0.0 ? per_thread[id] / (per_thread_ms[id] / 1000.0) : 0.0;
+        }
+    };
+
+private:
+    using Engine = Dijkstra<T, ReweightedGraph, Queue>;
+
+    int n;
+    std::shared_ptr<const G> graph;
+    int threads;
+    int tile;
+
+    std::vector<T> potential;
+    std::shared_ptr<const ReweightedGraph> reweighted;
+    std::vector<int> negative_cycle;
+    Stats stats;
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    static double ms_since(std::chrono::high_resolution_clock::time_point start) {
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+public:
+    // threads = 0: std::thread::hardware_concurrency()
+    explicit Johnson(std::shared_ptr<const G> g, int num_threads = 0, int tile_size = 64)
+        : n(g->get_vertices()), graph(std::move(g)), threads(num_threads),
+          tile(std::max(1, tile_size)) {
+        if (threads <= 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+    }
+
+    // Pasos 1 y 2. false si hay un ciclo negativo
+    bool compute_potentials(Metrics* M = nullptr) {
+        using EId = typename G::edge_type;
+        using VId = typename G::vertex_type;
+        using W = typename G::weight_type;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        // Grafo con la súper fuente V: sus aristas van al final
+        const EId m = graph->get_edges_count();
+        std::vector<EId> offsets(n + 2);
+        std::vector<VId> targets(m + n);
+        std::vector<W> weights(m + n);
+        for (int u = 0; u <= n; ++u) {
+            offsets[u] = u < n ? graph->edge_begin(u) : m;
+        }
+        offsets[n + 1] = m + n;
+        for (EId e = 0; e < m; ++e) {
+            targets[e] = graph->target(e);
+            weights[e] = graph->weight(e);
+        }
+        for (int v = 0; v < n; ++v) {
+            targets[m + v] = static_cast<VId>(v);
+            weights[m + v] = W(0);
+        }
+        auto augmented = std::make_shared<const G>(G::from_arrays(
+            n + 1, std::move(offsets), std::move(targets), std::move(weights)));
+
+        BellmanFord<T, G> bf(augmented);
+        bf.execute(n, M);
+        negative_cycle = bf.get_negative_cycle();
+        if (bf.has_negative_cycle()) {
+            stats.potentials_ms = ms_since(start);
+            potential.clear();
+            reweighted.reset();
+            return false;
+        }
+        potential.assign(bf.get_distances().begin(), bf.get_distances().begin() + n);
+        stats.potentials_ms = ms_since(start);
+
+        // Reponderación
+        start = std::chrono::high_resolution_clock::now();
+        std::vector<EId> r_offsets(n + 1);
+        std::vector<VId> r_targets(m);
+        std::vector<T> r_weights(m);
+        for (int u = 0; u < n; ++u) {
+            r_offsets[u + 1] = graph->edge_end(u);
+            for (EId e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+                int v = graph->target(e);
+                r_targets[e] = static_cast<VId>(v);
+                r_weights[e] = static_cast<T>(graph->weight(e)) + potential[u] - potential[v];
+            }
+        }
+        reweighted = std::make_shared<const ReweightedGraph>(ReweightedGraph::from_arrays(
+            n, std::move(r_offsets), std::move(r_targets), std::move(r_weights)));
+        stats.reweight_ms = ms_since(start);
+        return true;
+    }
+
+    // Paso 3: escribe la matriz en filename (INF = no alcanzado).
+    // Calcula los potenciales si hace falta; false si hay un ciclo
+    // negativo o no se pudo crear el archivo
+    bool run(const std::string& filename) {
+        if (!reweighted && !compute_potentials()) {
+            return false;
+        }
+
+        TiledDistanceMatrix<T> matrix;
+        if (!matrix.create(filename, n, tile)) {
+            return false;
+        }
+
+        int used = std::max(1, std::min(threads, n));
+        stats.threads = used;
+        stats.per_thread.assign(used, 0);
+        stats.per_thread_ms.assign(used, 0.0);
+
+        // Filas pendientes por banda: el hilo que termina la última
+        // la baja a disco
+        int bands = (n + tile - 1) / tile;
+        std::vector<std::atomic<int>> pending(bands);
+        for (int b = 0; b < bands; ++b) {
+            pending[b].store(std::min(tile, n - b * tile));
+        }
+        std::atomic<int> next{0};
+
+        auto worker = [&](int id) {
+            auto start = std::chrono::high_resolution_clock::now();
+            Engine engine(reweighted);
+            SSSPWorkspace<T> ws;
+
+            for (int s = next++; s < n; s = next++) {
+                engine.execute(s, ws);
+                const std::vector<T>& dist = ws.dist;
+                for (int t = 0; t < n; ++t) {
+                    matrix.set(s, t, dist[t] == INF ? INF
+                                                    : dist[t] - potential[s] + potential[t]);
+                }
+                stats.per_thread[id]++;
+
+                if (--pending[s / tile] == 0) {
+                    matrix.release_band(s);
+                }
+            }
+            stats.per_thread_ms[id] = ms_since(start);
+        };
+
+        auto start = std::chrono::high_resolution_clock::now();
+        if (used == 1) {
+            worker(0);
+        }
+        else {
+            std::vector<std::thread> pool;
+            for (int id = 0; id < used; ++id) {
+                pool.emplace_back(worker, id);
+            }
+            for (auto& th : pool) th.join();
+        }
+        stats.elapsed_ms = ms_since(start);
+        return true;
+    }
+
+    // Hubo un ciclo negativo (vértices en orden, vacío si no hubo)
+    bool has_negative_cycle() const { return !negative_cycle.empty(); }
+    const std::vector<int>& get_negative_cycle() const { return negative_cycle; }
+
+    // Getters
+    int get_vertices() const { return n; }
+    int get_threads() const { return threads; }
+    int get_tile() const { return tile; }
+    const std::vector<T>& get_potentials() const { return potential; }
+    std::shared_ptr<const ReweightedGraph> get_reweighted() const { return reweighted; }
+    const Stats& get_stats() const { return stats; }
+    static const char* queue_name() { return Queue<T>::name(); }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // JOHNSON_HPP
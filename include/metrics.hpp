@@ -3,6 +3,9 @@
 
 struct Metrics {
     long long count = 0;
+    long long settled = 0;   // vértices extraídos con distancia definitiva
+    long long corrected = 0; // vértices recorridos por una corrección final
+    long long rounds = 0;    // rondas sobre todas las aristas (Bellman-Ford)
 
     // helpers opcionales (solo para legibilidad)
     void assign(long long n = 1) { count += n; }
@@ -10,6 +13,11 @@ struct Metrics {
     void access(long long n = 1) { count += n; }
     void arithmetic(long long n = 1) { count += n; }
     void call(long long n = 1) { count += n; }
+
+    // espacio de búsqueda (no suma instrucciones)
+    void settle(long long n = 1) { settled += n; }
+    void correct(long long n = 1) { corrected += n; }
+    void round(long long n = 1) { rounds += n; }
 };
 
 #endif
@@ -0,0 +1,390 @@
+#ifndef PARALLEL_BELLMAN_FORD_HPP
+#define PARALLEL_BELLMAN_FORD_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "workspace.hpp"
+#include "thread_barrier.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PBF_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Núcleo que calcula los candidatos de cada vértice
+enum class BellmanFordKernel { Scalar, AVX2, AVX512 };
+
+inline const char* kernel_name(BellmanFordKernel k) {
+    switch (k) {
+        case BellmanFordKernel::AVX2: return "avx2";
+        case BellmanFordKernel::AVX512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+// Núcleo más ancho que soporta la CPU en ejecución
+inline BellmanFordKernel detect_kernel() {
+#ifdef PBF_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return BellmanFordKernel::AVX512;
+    if (__builtin_cpu_supports("avx2")) return BellmanFordKernel::AVX2;
+#endif
+    return BellmanFordKernel::Scalar;
+}
+
+// =====================================================
+// Bellman-Ford paralelo por datos (estilo Jacobi)
+//
+// Cada ronda calcula, para todo v,
+//   next[v] = min(cur[v], min_{(u,v)} cur[u] + w(u, v))
+// leyendo solo cur (doble buffer), así que las rondas no
+// dependen del orden y los hilos no se pisan: cada uno es
+// dueño de un rango de vértices destino, repartidos por
+// cantidad de aristas entrantes. Las aristas se recorren
+// sobre el grafo traspuesto en arreglos separados (from
+// en targets, pesos en weights; el destino es implícito
+// en los offsets), y los candidatos cur[from[i]] + w[i]
+// se calculan con gathers de 4 (AVX2) u 8 (AVX-512)
+// distancias. El núcleo se elige en ejecución según la
+// CPU; el escalar queda para el resto de las CPU y para
+// tipos sin núcleo vectorial (distancias que no son
+// enteros de 64 bits, IDs que no son de 32 bits).
+//
+// Tras k rondas cur tiene los caminos de a lo sumo k
+// aristas: sin ciclos negativos converge en n - 1 rondas,
+// y si la ronda n todavía cambia algo hay un ciclo
+// negativo alcanzable. El predecesor se busca solo
+// cuando v mejora (el argumento del mínimo).
+// =====================================================
+template<typename T, typename G = CSRGraph<T>>
+class ParallelBellmanFord {
+public:
+    using graph_type = G;
+    using distance_type = T;
+
+private:
+    using VId = typename G::vertex_type;
+    using W = typename G::weight_type;
+    using EId = typename G::edge_type;
+
+    // Tipos con núcleo vectorial
+    static constexpr bool simd_types =
+        std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 8 &&
+        std::is_integral<W>::value && std::is_signed<W>::value &&
+        (sizeof(W) == 2 || sizeof(W) == 4 || sizeof(W) == 8) &&
+        std::is_integral<VId>::value && sizeof(VId) == 4;
+
+    // Distancia interna de los no alcanzados (sin desborde al sumar)
+    static constexpr T BIG = std::numeric_limits<T>::max() / 4;
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    int n;
+    std::shared_ptr<const G> graph;  // grafo CSR compartido (solo lectura)
+    G rev;                           // aristas entrantes de cada vértice
+    int threads;
+    BellmanFordKernel kernel;
+
+    std::vector<int> split;   // hilo i: vértices [split[i], split[i + 1])
+    std::vector<T> cur, next; // doble buffer de distancias
+    std::vector<int> pred;
+    SSSPWorkspace<T> own;     // resultados de execute(source)
+
+    int rounds = 0;
+    bool negative_cycle = false;
+
+    // Equipo de hilos creado en el constructor y reutilizado entre
+    // consultas: cada execute abre con start y cierra con finish;
+    // dentro, barrier separa las rondas
+    std::vector<char> changed;   // el hilo i mejoró algún vértice en la ronda
+    bool done = false;
+    std::vector<std::thread> team;
+    std::unique_ptr<ThreadBarrier> start, finish, barrier;
+    bool stop = false;
+
+    // =====================================================
+    // Mínimo de cur[from[i]] + w[i] sobre [b, e), ignorando
+    // orígenes no alcanzados (BIG si no hay candidatos)
+    // =====================================================
+    static T min_scalar(const T* d, const VId* from, const W* w, EId b, EId e) {
+        T best = BIG;
+        for (EId i = b; i < e; ++i) {
+            T du = d[from[i]];
+            if (du < BIG && du + static_cast<T>(w[i]) < best) {
+                best = du + static_cast<T>(w[i]);
+            }
+        }
+        return best;
+    }
+
+#ifdef PBF_X86_SIMD
+    // Pesos de 16, 32 o 64 bits extendidos a 4 / 8 carriles de 64 bits
+    __attribute__((target("avx2")))
+    static __m256i load4(const W* p) {
+        if constexpr (sizeof(W) == 2) {
+            return _mm256_cvtepi16_epi64(_mm_loadl_epi64((const __m128i*)p));
+        }
+        else if constexpr (sizeof(W) == 4) {
+            return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)p));
+        }
+        else {
+            return _mm256_loadu_si256((const __m256i*)p);
+        }
+    }
+
+    __attribute__((target("avx512f")))
+    static __m512i load8(const W* p) {
+        if constexpr (sizeof(W) == 2) {
+            return _mm512_maskz_cvtepi16_epi64(0xFF, _mm_loadu_si128((const __m128i*)p));
+        }
+        else if constexpr (sizeof(W) == 4) {
+            return _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256((const __m256i*)p));
+        }
+        else {
+            return _mm512_loadu_si512((const void*)p);
+        }
+    }
+
+    __attribute__((target("avx2")))
+    static T min_avx2(const T* d, const VId* from, const W* w, EId b, EId e) {
+        const long long* base = reinterpret_cast<const long long*>(d);
+        const __m256i big = _mm256_set1_epi64x(BIG);
+        const __m256i reach = _mm256_set1_epi64x(BIG - 1);
+        __m256i best = big, best2 = big;   // dos cadenas independientes
+
+        EId i = b;
+        for (; i + 8 <= e; i += 8) {
+            __m128i idx = _mm_loadu_si128((const __m128i*)(from + i));
+            __m128i idx2 = _mm_loadu_si128((const __m128i*)(from + i + 4));
+            __m256i du = _mm256_i32gather_epi64(base, idx, 8);
+            __m256i du2 = _mm256_i32gather_epi64(base, idx2, 8);
+            __m256i cand = _mm256_add_epi64(du, load4(w + i));
+            __m256i cand2 = _mm256_add_epi64(du2, load4(w + i + 4));
+            cand = _mm256_blendv_epi8(cand, big, _mm256_cmpgt_epi64(du, reach));
+            cand2 = _mm256_blendv_epi8(cand2, big, _mm256_cmpgt_epi64(du2, reach));
+            best = _mm256_blendv_epi8(best, cand, _mm256_cmpgt_epi64(best, cand));
+            best2 = _mm256_blendv_epi8(best2, cand2, _mm256_cmpgt_epi64(best2, cand2));
+        }
+        best = _mm256_blendv_epi8(best, best2, _mm256_cmpgt_epi64(best, best2));
+
+        alignas(32) long long lanes[4];
+        _mm256_store_si256((__m256i*)lanes, best);
+        T m = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        return std::min(m, min_scalar(d, from, w, i, e));
+    }
+
+    __attribute__((target("avx512f")))
+    static T min_avx512(const T* d, const VId* from, const W* w, EId b, EId e) {
+        const long long* base = reinterpret_cast<const long long*>(d);
+        const __m512i big = _mm512_set1_epi64(BIG);
+        __m512i best = big;
+
+        EId i = b;
+        for (; i + 8 <= e; i += 8) {
+            __m256i idx = _mm256_loadu_si256((const __m256i*)(from + i));
+            __m512i du = _mm512_mask_i32gather_epi64(big, 0xFF, idx, (const void*)base, 8);
+            __m512i cand = _mm512_add_epi64(du, load8(w + i));
+            best = _mm512_mask_min_epi64(best, _mm512_cmplt_epi64_mask(du, big), best, cand);
+        }
+
+        alignas(64) long long lanes[8];
+        _mm512_store_si512((void*)lanes, best);
+        T m = *std::min_element(lanes, lanes + 8);
+        return std::min(m, min_scalar(d, from, w, i, e));
+    }
+#endif
+
+    T min_candidate(const T* d, const VId* from, const W* w, EId b, EId e) const {
+#ifdef PBF_X86_SIMD
+        if constexpr (simd_types) {
+            if (kernel == BellmanFordKernel::AVX512) return min_avx512(d, from, w, b, e);
+            if (kernel == BellmanFordKernel::AVX2) return min_avx2(d, from, w, b, e);
+        }
+#endif
+        return min_scalar(d, from, w, b, e);
+    }
+
+    // Rangos de vértices con cantidades parecidas de aristas entrantes
+    void partition_vertices() {
+        split.assign(threads + 1, n);
+        split[0] = 0;
+        EId m = rev.get_edges_count();
+        int v = 0;
+        for (int i = 1; i < threads; ++i) {
+            EId goal = m / threads * i;
+            while (v < n && rev.edge_begin(v) < goal) ++v;
+            split[i] = v;
+        }
+    }
+
+    // Una ronda sobre los vértices del hilo id
+    void relax(int id) {
+        const EId* offsets = rev.get_offsets().data();
+        const VId* from = rev.get_targets().data();
+        const W* w = rev.get_weights().data();
+        const T* d = cur.data();
+        T* out = next.data();
+        char any = 0;
+        for (int v = split[id]; v < split[id + 1]; ++v) {
+            T best = min_candidate(d, from, w, offsets[v], offsets[v + 1]);
+            if (best < d[v]) {
+                out[v] = best;
+                any = 1;
+                // Argumento del mínimo (solo cuando v mejora)
+                for (EId i = offsets[v]; i < offsets[v + 1]; ++i) {
+                    T du = d[from[i]];
+                    if (du < BIG && du + static_cast<T>(w[i]) == best) {
+                        pred[v] = from[i];
+                        break;
+                    }
+                }
+            }
+            else {
+                out[v] = d[v];
+            }
+        }
+        changed[id] = any;
+    }
+
+    // Rondas hasta que nada cambie (o la ronda n)
+    void work(int id) {
+        while (!done) {
+            relax(id);
+            barrier->wait();
+            if (id == 0) {
+                rounds++;
+                bool any = std::find(changed.begin(), changed.end(), 1) != changed.end();
+                cur.swap(next);
+                negative_cycle = any && rounds >= n;
+                done = !any || rounds >= n;
+            }
+            barrier->wait();
+        }
+    }
+
+public:
+    // threads <= 0: todos los núcleos. El núcleo pedido se baja
+    // al que soporte la CPU (y a escalar si los tipos no tienen
+    // núcleo vectorial)
+    ParallelBellmanFord(std::shared_ptr<const G> g, int num_threads = 0,
+                        BellmanFordKernel requested = detect_kernel())
+        : n(g->get_vertices()), graph(std::move(g)), threads(num_threads) {
+        if (threads <= 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threads = std::max(1, std::min(threads, std::max(1, n)));
+
+        BellmanFordKernel best = simd_types ? detect_kernel() : BellmanFordKernel::Scalar;
+        kernel = std::min(requested, best);
+
+        rev = graph->reversed();
+        partition_vertices();
+        cur.resize(n);
+        next.resize(n);
+        pred.resize(n);
+        changed.assign(threads, 0);
+
+        barrier.reset(new ThreadBarrier(threads));
+        if (threads > 1) {
+            start.reset(new ThreadBarrier(threads));
+            finish.reset(new ThreadBarrier(threads));
+            for (int id = 1; id < threads; ++id) {
+                team.emplace_back([this, id]() {
+                    while (true) {
+                        start->wait();
+                        if (stop) return;
+                        work(id);
+                        finish->wait();
+                    }
+                });
+            }
+        }
+    }
+
+    // El equipo guarda this: ni copias ni movimientos
+    ParallelBellmanFord(const ParallelBellmanFord&) = delete;
+    ParallelBellmanFord& operator=(const ParallelBellmanFord&) = delete;
+
+    ~ParallelBellmanFord() {
+        if (team.empty()) return;
+        stop = true;
+        start->wait();
+        for (auto& th : team) th.join();
+    }
+
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return {{}, {}};
+        }
+
+        execute(source, own, M);
+        return {own.dist, own.pred};
+    }
+
+    // Resultado en un workspace del llamador
+    void execute(int source, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return;
+        }
+
+        std::fill(cur.begin(), cur.end(), BIG);
+        std::fill(pred.begin(), pred.end(), -1);
+        cur[source] = 0;
+        if (M) M->assign(2 * n);
+
+        done = (n == 1);
+        rounds = 0;
+        negative_cycle = false;
+
+        if (threads == 1) {
+            work(0);
+        }
+        else {
+            start->wait();
+            work(0);
+            finish->wait();
+        }
+
+        if (M) {
+            M->arithmetic((long long)rounds * rev.get_edges_count());
+            M->compare((long long)rounds * (rev.get_edges_count() + n));
+            M->round(rounds);
+        }
+
+        // Copiar al workspace (BIG = no alcanzado)
+        ws.reset(n, INF);
+        for (int v = 0; v < n; ++v) {
+            if (cur[v] < BIG) ws.update(v, cur[v], pred[v]);
+        }
+    }
+
+    // Hubo un ciclo negativo alcanzable en la última ejecución
+    // (las distancias de esa ejecución no son válidas)
+    bool has_negative_cycle() const { return negative_cycle; }
+
+    // Getters
+    int get_vertices() const { return n; }
+    int get_threads() const { return threads; }
+    int get_rounds() const { return rounds; }
+    BellmanFordKernel get_kernel() const { return kernel; }
+    const char* queue_name() const { return kernel_name(kernel); }
+
+    // Bytes leídos por ronda (aristas en arreglos separados, una
+    // distancia por arista y los dos buffers de distancias)
+    double bytes_per_round() const {
+        double m = (double)rev.get_edges_count();
+        return m * (sizeof(VId) + sizeof(W) + sizeof(T)) + n * (sizeof(EId) + 2.0 * sizeof(T));
+    }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // PARALLEL_BELLMAN_FORD_HPP
@@ -0,0 +1,299 @@
+#ifndef PRIORITY_QUEUES_HPP
+#define PRIORITY_QUEUES_HPP
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+// =====================================================
+// Políticas de cola de prioridad para Dijkstra y BMSSP
+//
+// Todas comparten la misma interfaz (parámetro de plantilla
+// `template<typename> class Queue` de los algoritmos):
+//
+//   void init(int n, K max_weight = 0)
+//                           preparar para vértices [0, n); las colas
+//                           con uses_max_weight = true (Dial, ver
+//                           bucket_queues.hpp) necesitan el peso máximo
+//   void clear()            vaciar la cola
+//   bool empty() const
+//   void push(int v, K key) insertar v o disminuir su clave
+//   std::pair<K,int> pop()  extraer el mínimo (clave, vértice)
+//   static const char* name()
+//
+// Las colas indexadas mantienen una sola entrada por vértice
+// (decrease-key); la cola perezosa inserta duplicados y el
+// algoritmo descarta las entradas obsoletas al extraerlas.
+// =====================================================
+
+// =====================================================
+// Heap binario con borrado perezoso (equivalente a
+// std::priority_queue, pero conserva la capacidad al vaciarse)
+// =====================================================
+template<typename K>
+class LazyBinaryHeap {
+private:
+    using Entry = std::pair<K, int>;
+    std::vector<Entry> heap;
+
+public:
+    static constexpr bool uses_max_weight = false;
+
+    void init(int /*n*/, K /*max_weight*/ = K()) { heap.clear(); }
+    void clear() { heap.clear(); }
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+
+    void push(int v, K key) {
+        heap.push_back({key, v});
+        std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+    }
+
+    Entry pop() {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+        Entry top = heap.back();
+        heap.pop_back();
+        return top;
+    }
+
+    static const char* name() { return "lazy-binary"; }
+};
+
+// =====================================================
+// Heap d-ario indexado con decrease-key
+// =====================================================
+template<typename K, int D = 4>
+class DaryHeap {
+private:
+    struct Entry {
+        K key;
+        int v;
+    };
+
+    std::vector<Entry> heap;
+    std::vector<int> pos;  // posición de cada vértice en heap (-1 si no está)
+
+    void place(int i, const Entry& e) {
+        heap[i] = e;
+        pos[e.v] = i;
+    }
+
+    void sift_up(int i) {
+        Entry e = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (!(e.key < heap[parent].key)) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, e);
+    }
+
+    void sift_down(int i) {
+        Entry e = heap[i];
+        int size = heap.size();
+        while (true) {
+            int first = i * D + 1;
+            if (first >= size) break;
+
+            int best = first;
+            int last = std::min(first + D, size);
+            for (int c = first + 1; c < last; ++c) {
+                if (heap[c].key < heap[best].key) best = c;
+            }
+            if (!(heap[best].key < e.key)) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, e);
+    }
+
+public:
+    static constexpr bool uses_max_weight = false;
+
+    void init(int n, K /*max_weight*/ = K()) {
+        heap.clear();
+        pos.assign(n, -1);
+    }
+
+    // O(tamaño): solo se reinician los vértices que quedaron en la cola
+    void clear() {
+        for (const auto& e : heap) pos[e.v] = -1;
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+
+    void push(int v, K key) {
+        int i = pos[v];
+        if (i < 0) {
+            heap.push_back({key, v});
+            pos[v] = heap.size() - 1;
+            sift_up(heap.size() - 1);
+        }
+        else if (key < heap[i].key) {
+            heap[i].key = key;
+            sift_up(i);
+        }
+    }
+
+    std::pair<K, int> pop() {
+        Entry top = heap[0];
+        pos[top.v] = -1;
+
+        Entry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            pos[last.v] = 0;
+            sift_down(0);
+        }
+        return {top.key, top.v};
+    }
+
+    static const char* name() {
+        static const std::string s = std::to_string(D) + "-ary";
+        return s.c_str();
+    }
+};
+
+template<typename K>
+using QuaternaryHeap = DaryHeap<K, 4>;
+
+// =====================================================
+// Pairing heap con decrease-key (nodos indexados por vértice)
+// =====================================================
+template<typename K>
+class PairingHeap {
+private:
+    struct Node {
+        K key;
+        int child = -1;    // hijo más a la izquierda
+        int sibling = -1;  // hermano derecho
+        int prev = -1;     // padre (si es el primer hijo) o hermano izquierdo
+        bool in_heap = false;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> pending;  // buffer del two-pass merge
+    int root = -1;
+    std::size_t count = 0;
+
+    // Unir dos raíces; devuelve la nueva raíz
+    int meld(int a, int b) {
+        if (a < 0) return b;
+        if (b < 0) return a;
+        if (nodes[b].key < nodes[a].key) std::swap(a, b);
+
+        // b pasa a ser el primer hijo de a
+        nodes[b].sibling = nodes[a].child;
+        nodes[b].prev = a;
+        if (nodes[a].child >= 0) nodes[nodes[a].child].prev = b;
+        nodes[a].child = b;
+        nodes[a].sibling = -1;
+        nodes[a].prev = -1;
+        return a;
+    }
+
+    // Separar el subárbol de v de su padre/hermanos
+    void cut(int v) {
+        int p = nodes[v].prev;
+        if (p < 0) return;
+
+        if (nodes[p].child == v) nodes[p].child = nodes[v].sibling;
+        else nodes[p].sibling = nodes[v].sibling;
+
+        if (nodes[v].sibling >= 0) nodes[nodes[v].sibling].prev = p;
+        nodes[v].sibling = -1;
+        nodes[v].prev = -1;
+    }
+
+    void release(int v) {
+        nodes[v].child = nodes[v].sibling = nodes[v].prev = -1;
+        nodes[v].in_heap = false;
+    }
+
+public:
+    static constexpr bool uses_max_weight = false;
+
+    void init(int n, K /*max_weight*/ = K()) {
+        nodes.assign(n, Node());
+        root = -1;
+        count = 0;
+    }
+
+    // O(tamaño): recorre los nodos que siguen en la cola
+    void clear() {
+        if (root >= 0) {
+            pending.clear();
+            pending.push_back(root);
+            while (!pending.empty()) {
+                int v = pending.back();
+                pending.pop_back();
+                for (int c = nodes[v].child; c >= 0; c = nodes[c].sibling) {
+                    pending.push_back(c);
+                }
+                release(v);
+            }
+        }
+        root = -1;
+        count = 0;
+    }
+
+    bool empty() const { return root < 0; }
+    std::size_t size() const { return count; }
+
+    void push(int v, K key) {
+        Node& node = nodes[v];
+        if (!node.in_heap) {
+            node.key = key;
+            node.in_heap = true;
+            count++;
+            root = meld(root, v);
+        }
+        else if (key < node.key) {
+            node.key = key;
+            if (v != root) {
+                cut(v);
+                root = meld(root, v);
+            }
+        }
+    }
+
+    std::pair<K, int> pop() {
+        int top = root;
+        K key = nodes[top].key;
+
+        // Two-pass: unir hijos por pares de izquierda a derecha...
+        pending.clear();
+        int c = nodes[top].child;
+        while (c >= 0) {
+            int a = c;
+            int b = nodes[a].sibling;
+            c = b >= 0 ? nodes[b].sibling : -1;
+
+            nodes[a].sibling = nodes[a].prev = -1;
+            if (b >= 0) nodes[b].sibling = nodes[b].prev = -1;
+            pending.push_back(meld(a, b));
+        }
+
+        // ... y luego de derecha a izquierda
+        int r = -1;
+        for (int i = (int)pending.size() - 1; i >= 0; --i) {
+            r = meld(pending[i], r);
+        }
+
+        release(top);
+        root = r;
+        count--;
+        return {key, top};
+    }
+
+    static const char* name() { return "pairing"; }
+};
+
+#endif // PRIORITY_QUEUES_HPP
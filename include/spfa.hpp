@@ -0,0 +1,224 @@
+#ifndef SPFA_HPP
+#define SPFA_HPP
+
+#include "metrics.hpp"
+#include "csr_graph.hpp"
+#include "workspace.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <memory>
+
+// =====================================================
+// SPFA (Shortest Path Faster Algorithm)
+//
+// Bellman-Ford con cola: solo se vuelven a relajar las
+// aristas de los vértices cuya distancia cambió. Cada
+// vértice está a lo sumo una vez en la cola (in_queue), así
+// que la cola es un buffer circular de n posiciones.
+//
+// Heurísticas opcionales sobre el orden de la cola:
+//   SLF (Small Label First): un vértice que entra con
+//       distancia menor que la del frente va al frente
+//   LLL (Large Label Last): mientras el frente tenga
+//       distancia mayor que el promedio de la cola, pasa
+//       al final
+//
+// Ciclos negativos: length[v] cuenta las relajaciones
+// encadenadas del camino tentativo hasta v. Si llega a n,
+// el camino repite un vértice y hay un ciclo negativo
+// alcanzable; la búsqueda se detiene (vale con cualquier
+// orden de la cola, a diferencia de contar encolados).
+// =====================================================
+template<typename T, typename G = CSRGraph<T>>
+class SPFA {
+public:
+    using graph_type = G;
+    using distance_type = T;
+
+private:
+    int n;  // número de vértices
+    CSRGraphBuilder<G> graph;  // grafo CSR compartido (solo lectura)
+    SSSPWorkspace<T> own;      // workspace de execute(source)
+    bool slf;
+    bool lll;
+
+    // Cola circular, marcas y largo de los caminos tentativos
+    // (reservados una vez; la cola queda vacía tras cada búsqueda)
+    std::vector<int> ring;
+    std::vector<char> in_queue;
+    std::vector<int> length;
+    int negative_cycle = -1;  // vértice que lo detectó (-1 si no hubo)
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+
+    void init() {
+        ring.assign(std::max(1, n), 0);
+        in_queue.assign(n, 0);
+        length.assign(n, 0);
+    }
+
+public:
+    SPFA(int vertices, bool small_label_first = false, bool large_label_last = false)
+        : n(vertices), graph(vertices), slf(small_label_first), lll(large_label_last) {
+        init();
+    }
+
+    // Usar un grafo CSR ya construido, compartido con otros algoritmos
+    SPFA(std::shared_ptr<const G> g, bool small_label_first = false,
+         bool large_label_last = false)
+        : n(g->get_vertices()), graph(std::move(g)),
+          slf(small_label_first), lll(large_label_last) {
+        init();
+    }
+
+    // Agregar arista dirigida
+    void add_edge(int u, int v, T weight) {
+        if (u >= 0 && u < n && v >= 0 && v < n) {
+            graph.add_edge(u, v, weight);
+        }
+    }
+
+    // Heurísticas activas
+    const char* queue_name() const {
+        return slf ? (lll ? "slf-lll" : "slf") : (lll ? "lll" : "fifo");
+    }
+
+    // Ejecutar SPFA desde un nodo fuente
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return {{}, {}};
+        }
+
+        execute(source, own, M);
+        return {own.dist, own.pred};
+    }
+
+    // Igual que execute, pero sobre un workspace del llamador: no hay
+    // copia de resultados (leerlos con ws.distances()/predecessors())
+    void execute(int source, SSSPWorkspace<T>& ws, Metrics* M = nullptr) {
+        if (source < 0 || source >= n) {
+            return;
+        }
+
+        const G& g = graph.get();
+
+        // Reinicio O(tocados) salvo la primera vez
+        if (M) M->assign(2 * (ws.dist.size() == (std::size_t)n ? ws.touched_count() : n));
+        ws.reset(n, INF);
+        const std::vector<T>& dist = ws.dist;
+
+        negative_cycle = -1;
+        std::size_t head = 0, size = 0;
+        const std::size_t cap = ring.size();
+        double sum = 0.0;   // suma de distancias en la cola (LLL)
+
+        auto push = [&](int v) {
+            if (slf && size > 0 && dist[v] < dist[ring[head]]) {
+                head = (head + cap - 1) % cap;
+                ring[head] = v;
+            }
+            else {
+                ring[(head + size) % cap] = v;
+            }
+            size++;
+            in_queue[v] = 1;
+            if (lll) sum += (double)dist[v];
+        };
+
+        ws.update(source, 0, -1);
+        length[source] = 0;
+        push(source);
+        if (M) M->assign(4);
+
+        while (size > 0) {
+            if (M) M->compare();
+
+            // LLL: el frente pasa al final mientras supere el promedio
+            if (lll) {
+                for (std::size_t k = 1; k < size && dist[ring[head]] * (double)size > sum; ++k) {
+                    ring[(head + size) % cap] = ring[head];
+                    head = (head + 1) % cap;
+                    if (M) {
+                        M->compare(2);
+                        M->assign(2);
+                    }
+                }
+            }
+
+            int u = ring[head];
+            head = (head + 1) % cap;
+            size--;
+            in_queue[u] = 0;
+            if (lll) sum -= (double)dist[u];
+            if (M) M->assign(4);
+
+            for (auto e = g.edge_begin(u); e < g.edge_end(u); ++e) {
+                if (M) {
+                    M->access(2);  // target, weight
+                }
+
+                int v = g.target(e);
+                T new_dist = dist[u] + static_cast<T>(g.weight(e));
+                if (M) {
+                    M->arithmetic();
+                    M->assign(2);
+                }
+
+                if (new_dist < dist[v]) {
+                    if (M) {
+                        M->compare();
+                        M->access(2);
+                        M->assign(3);
+                    }
+
+                    if (lll && in_queue[v]) sum += (double)new_dist - (double)dist[v];
+                    ws.update(v, new_dist, u);
+                    length[v] = length[u] + 1;
+
+                    if (length[v] >= n) {
+                        negative_cycle = v;
+
+                        // Vaciar la cola para la próxima búsqueda
+                        for (; size > 0; --size, head = (head + 1) % cap) {
+                            in_queue[ring[head]] = 0;
+                        }
+                        return;
+                    }
+
+                    if (!in_queue[v]) {
+                        push(v);
+                        if (M) M->call();
+                    }
+                }
+            }
+        }
+    }
+
+    // Hubo un ciclo negativo alcanzable en la última ejecución
+    // (las distancias de esa ejecución no son válidas)
+    bool has_negative_cycle() const { return negative_cycle >= 0; }
+
+    // Vértice cuyo camino tentativo llegó a n aristas (-1 si no hubo)
+    int get_negative_cycle_vertex() const { return negative_cycle; }
+
+    // Obtener distancia a un destino
+    T get_distance(int destination) const {
+        if (destination >= 0 && destination < n && !own.dist.empty()) {
+            return own.dist[destination];
+        }
+        return INF;
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    bool uses_slf() const { return slf; }
+    bool uses_lll() const { return lll; }
+    std::shared_ptr<const G> get_graph() { return graph.shared(); }
+
+    // Valor infinito público para comparaciones
+    static T infinity() { return INF; }
+};
+
+#endif // SPFA_HPP
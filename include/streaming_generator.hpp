@@ -0,0 +1,390 @@
+#ifndef STREAMING_GENERATOR_HPP
+#define STREAMING_GENERATOR_HPP
+
+#include "graph_cache.hpp"
+
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+// =====================================================
+// Generador de grafos por flujo (millones de vértices)
+//
+// Mismo modelo que GraphGenerator: un árbol aleatorio con
+// raíz 0 (el padre de i es uniforme en [0, i)) asegura que
+// todo es alcanzable desde 0, y el resto de las aristas
+// son pares (u, v) distintos al azar, sin lazos ni
+// repetidos, con pesos en [1, 100]. En lugar de guardar
+// las aristas y un std::set global, se trabaja por bloques
+// de vértices origen, con memoria O(V) y no O(E):
+//
+// 1. Hijos del árbol de cada vértice (conteo + ubicación).
+// 2. Aristas extra de cada u: Binomial(candidatos, p),
+//    con p tal que el total esperado sea E (64 bits).
+// 3. Cada hilo toma el siguiente bloque y arma sus listas
+//    de adyacencia ordenadas: los destinos extra se
+//    muestrean sin repetir (rechazo + orden si son pocos,
+//    muestreo secuencial si son más de la mitad). Un
+//    escritor saca los bloques en orden; a lo sumo hay
+//    2 x hilos bloques en memoria.
+//
+// Cada bloque y cada paso tienen su propio generador con
+// semilla derivada de (seed, paso, bloque): el grafo no
+// depende de la cantidad de hilos.
+//
+// Salida: DIMACS (.gr) o la caché binaria CSR de
+// GraphCache<W, VId, EId>, que se puede mapear directo.
+// =====================================================
+template<typename W = std::int16_t, typename VId = std::uint32_t, typename EId = long long>
+class StreamingGraphGenerator {
+public:
+    enum class Format { Dimacs, Binary };
+
+private:
+    using Cache = GraphCache<W, VId, EId>;
+
+    // Aristas y vértices de un bloque ya armado
+    struct Chunk {
+        long long block = -1;
+        std::string text;          // Dimacs
+        std::vector<VId> targets;  // Binary
+        std::vector<W> weights;
+    };
+
+    unsigned long long seed;
+    int threads;
+    int block_size;
+
+    int n = 0;
+    long long m = 0;
+    double elapsed_ms = 0.0;
+
+    // Árbol: hijos de u en children[child_start[u] .. child_start[u + 1])
+    std::vector<std::uint32_t> child_start;
+    std::vector<std::uint32_t> children;
+    std::vector<std::uint32_t> extra;  // aristas extra de cada vértice
+
+    static std::uint64_t splitmix64(std::uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    // Generador del paso `stage` para el bloque b
+    std::mt19937_64 block_rng(int stage, long long b) const {
+        return std::mt19937_64(splitmix64(splitmix64(seed + stage) ^ (std::uint64_t)b));
+    }
+
+    long long blocks() const { return (n + (long long)block_size - 1) / block_size; }
+    int block_begin(long long b) const { return (int)(b * block_size); }
+    int block_end(long long b) const { return (int)std::min<long long>(n, (b + 1) * block_size); }
+
+    // Ejecuta body(b) para cada bloque, repartidos entre los hilos
+    template<typename Body>
+    void for_each_block(Body&& body) const {
+        std::atomic<long long> next{0};
+        auto worker = [&]() {
+            for (long long b = next++; b < blocks(); b = next++) body(b);
+        };
+        std::vector<std::thread> pool;
+        for (int id = 1; id < threads; ++id) pool.emplace_back(worker);
+        worker();
+        for (auto& th : pool) th.join();
+    }
+
+    // Padre en el árbol de cada vértice del bloque b (la raíz no tiene)
+    template<typename Visit>
+    void tree_parents(long long b, Visit&& visit) const {
+        auto rng = block_rng(0, b);
+        for (int v = std::max(1, block_begin(b)); v < block_end(b); ++v) {
+            visit(v, (int)std::uniform_int_distribution<int>(0, v - 1)(rng));
+        }
+    }
+
+    // Binomial(c, p) contando los saltos geométricos entre éxitos:
+    // O(resultado) y sin lgamma (std::binomial_distribution la usa y
+    // escribe la global signgam, una carrera entre hilos)
+    static long long binomial(long long c, double p, std::mt19937_64& rng) {
+        if (c <= 0 || p <= 0.0) return 0;
+        if (p >= 1.0) return c;
+
+        std::geometric_distribution<long long> gap(p);  // fracasos antes de un éxito
+        long long k = 0;
+        for (long long pos = gap(rng); pos < c; pos += gap(rng) + 1) k++;
+        return k;
+    }
+
+    // Pasos 1 y 2
+    void build_degrees(long long edges) {
+        std::vector<std::atomic<std::uint32_t>> count(n + 1);
+        for (auto& c : count) c.store(0, std::memory_order_relaxed);
+
+        for_each_block([&](long long b) {
+            tree_parents(b, [&](int, int p) {
+                count[p + 1].fetch_add(1, std::memory_order_relaxed);
+            });
+        });
+
+        child_start.assign(n + 1, 0);
+        for (int u = 0; u < n; ++u) {
+            child_start[u + 1] = child_start[u] + count[u + 1].load(std::memory_order_relaxed);
+            count[u].store(child_start[u], std::memory_order_relaxed);  // cursor
+        }
+
+        children.assign(n > 0 ? n - 1 : 0, 0);
+        for_each_block([&](long long b) {
+            tree_parents(b, [&](int v, int p) {
+                children[count[p].fetch_add(1, std::memory_order_relaxed)] = v;
+            });
+        });
+
+        // Pares candidatos fuera del árbol: n (n - 1) - (n - 1)
+        double candidates = (double)(n - 1) * (double)(n - 1);
+        long long wanted = std::max(0LL, edges - (n - 1));
+        double p = candidates > 0.0 ? std::min(1.0, wanted / candidates) : 0.0;
+
+        extra.assign(n, 0);
+        std::atomic<long long> total{n > 0 ? n - 1 : 0};
+        for_each_block([&](long long b) {
+            auto rng = block_rng(1, b);
+            long long sum = 0;
+            for (int u = block_begin(b); u < block_end(b); ++u) {
+                std::sort(children.begin() + child_start[u], children.begin() + child_start[u + 1]);
+                long long c = (n - 1) - (long long)(child_start[u + 1] - child_start[u]);
+                extra[u] = (std::uint32_t)binomial(c, p, rng);
+                sum += extra[u];
+            }
+            total += sum;
+        });
+        m = total.load();
+    }
+
+    // Destinos de u (ordenados, sin repetir) en out
+    void adjacency(int u, std::mt19937_64& rng, std::vector<VId>& out,
+                   std::vector<VId>& sample) const {
+        const std::uint32_t* first = children.data() + child_start[u];
+        const std::uint32_t* last = children.data() + child_start[u + 1];
+        auto taken = [&](long long v) {
+            return v == u || std::binary_search(first, last, (std::uint32_t)v);
+        };
+
+        long long k = extra[u];
+        long long c = (n - 1) - (long long)(last - first);
+        sample.clear();
+        if (2 * k <= c) {
+            // Pocos: rechazo, y se repite hasta tener k distintos
+            std::uniform_int_distribution<int> pick(0, n - 1);
+            while ((long long)sample.size() < k) {
+                while ((long long)sample.size() < k) {
+                    int v = pick(rng);
+                    if (!taken(v)) sample.push_back((VId)v);
+                }
+                std::sort(sample.begin(), sample.end());
+                sample.erase(std::unique(sample.begin(), sample.end()), sample.end());
+            }
+        }
+        else {
+            // Muchos: muestreo secuencial (ya sale ordenado)
+            long long left = c;
+            for (int v = 0; v < n && k > 0; ++v) {
+                if (taken(v)) continue;
+                if ((long long)(rng() % (std::uint64_t)left) < k) {
+                    sample.push_back((VId)v);
+                    k--;
+                }
+                left--;
+            }
+        }
+
+        out.resize(sample.size() + (last - first));
+        std::merge(sample.begin(), sample.end(), first, last, out.begin());
+    }
+
+    // Paso 3 para el bloque b
+    void build_chunk(long long b, Format format, Chunk& chunk,
+                     std::vector<VId>& targets, std::vector<VId>& sample) const {
+        auto rng = block_rng(2, b);
+        std::uniform_int_distribution<int> weight(1, 100);
+
+        chunk.block = b;
+        chunk.text.clear();
+        chunk.targets.clear();
+        chunk.weights.clear();
+
+        char number[24];
+        auto append = [&](long long x) {
+            auto res = std::to_chars(number, number + sizeof(number), x);
+            chunk.text.append(number, res.ptr);
+        };
+
+        for (int u = block_begin(b); u < block_end(b); ++u) {
+            adjacency(u, rng, targets, sample);
+            for (VId v : targets) {
+                int w = weight(rng);
+                if (format == Format::Binary) {
+                    chunk.targets.push_back(v);
+                    chunk.weights.push_back((W)w);
+                }
+                else {
+                    chunk.text += "a ";
+                    append(u);
+                    chunk.text += ' ';
+                    append(v);
+                    chunk.text += ' ';
+                    append(w);
+                    chunk.text += '\n';
+                }
+            }
+        }
+    }
+
+public:
+    // threads = 0: std::thread::hardware_concurrency()
+    explicit StreamingGraphGenerator(unsigned long long seed_ = 42, int num_threads = 0,
+                                     int vertices_per_block = 4096)
+        : seed(seed_), threads(num_threads), block_size(std::max(1, vertices_per_block)) {
+        if (threads <= 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+    }
+
+    // Aristas pedidas por densidad (mismas fórmulas que GraphGenerator)
+    static long long low_edges(long long vertices) { return vertices; }
+    static long long medium_edges(long long vertices) {
+        return vertices > 1 ? (long long)(vertices * std::log2((double)vertices)) : 0;
+    }
+    static long long high_edges(long long vertices) { return vertices * vertices / 2; }
+
+    // Generar un grafo de `vertices` vértices y ~`edges` aristas
+    // (al menos el árbol, a lo sumo V (V - 1)) y escribirlo en filename
+    bool generate(const std::string& filename, int vertices, long long edges,
+                  Format format, const std::string& density) {
+        auto start = std::chrono::high_resolution_clock::now();
+        n = std::max(0, vertices);
+        build_degrees(edges);
+
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Error: no se pudo crear " << filename << "\n";
+            return false;
+        }
+
+        // Cabecera y, en binario, los offsets (ya se conocen los grados)
+        typename Cache::Layout layout = Cache::layout(n, m);
+        if (format == Format::Binary) {
+            Cache::write_header(out, n, m);
+            std::vector<EId> offsets;
+            EId pos = 0;
+            for (long long b = 0; b < blocks(); ++b) {
+                offsets.clear();
+                for (int u = block_begin(b); u < block_end(b); ++u) {
+                    offsets.push_back(pos);
+                    pos += (EId)(child_start[u + 1] - child_start[u]) + extra[u];
+                }
+                out.write(reinterpret_cast<const char*>(offsets.data()),
+                          offsets.size() * sizeof(EId));
+            }
+            out.write(reinterpret_cast<const char*>(&pos), sizeof(EId));
+        }
+        else {
+            out << "c Grafo generado para benchmark BMSSP vs Dijkstra\n";
+            out << "c Vertices: " << n << "\n";
+            out << "c Aristas: " << m << "\n";
+            out << "c Densidad: " << density << "\n";
+            out << "c Seed: " << seed << "\n";
+            out << "p sp " << n << " " << m << "\n";
+        }
+
+        // Paso 3: bloques en paralelo, escritura en orden. El bloque b
+        // espera su turno en slots[b % slots.size()]
+        std::vector<Chunk> slots(2 * threads);
+        std::mutex lock;
+        std::condition_variable filled, freed;
+        long long written = 0;
+        std::atomic<long long> next{0};
+
+        auto worker = [&]() {
+            Chunk chunk;
+            std::vector<VId> targets, sample;
+            for (long long b = next++; b < blocks(); b = next++) {
+                build_chunk(b, format, chunk, targets, sample);
+
+                std::unique_lock<std::mutex> guard(lock);
+                freed.wait(guard, [&]() { return b < written + (long long)slots.size(); });
+                std::swap(slots[b % slots.size()], chunk);
+                filled.notify_all();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (int id = 0; id < threads; ++id) pool.emplace_back(worker);
+
+        Chunk chunk;
+        EId edge = 0;
+        for (long long b = 0; b < blocks(); ++b) {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                Chunk& slot = slots[b % slots.size()];
+                filled.wait(guard, [&]() { return slot.block == b; });
+                std::swap(slot, chunk);
+                slot.block = -1;
+            }
+
+            if (format == Format::Binary) {
+                out.seekp(layout.targets_pos + edge * sizeof(VId));
+                out.write(reinterpret_cast<const char*>(chunk.targets.data()),
+                          chunk.targets.size() * sizeof(VId));
+                out.seekp(layout.weights_pos + edge * sizeof(W));
+                out.write(reinterpret_cast<const char*>(chunk.weights.data()),
+                          chunk.weights.size() * sizeof(W));
+                edge += chunk.targets.size();
+            }
+            else {
+                out.write(chunk.text.data(), chunk.text.size());
+            }
+
+            std::lock_guard<std::mutex> guard(lock);
+            written++;
+            freed.notify_all();
+        }
+        for (auto& th : pool) th.join();
+
+        // Sin aristas, el archivo igual debe llegar hasta los pesos
+        if (format == Format::Binary && m == 0 &&
+            layout.offsets_pos + (n + 1) * sizeof(EId) < layout.weights_pos) {
+            out.seekp(layout.weights_pos - 1);
+            out.put('\0');
+        }
+        out.close();
+        if (!out) {
+            std::cerr << "Error: escritura incompleta en " << filename << "\n";
+            return false;
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        std::cout << "Grafo " << density << ": V=" << n << ", E=" << m << " ("
+                  << elapsed_ms << " ms, " << threads << " hilos)\n";
+        return true;
+    }
+
+    // Getters
+    int get_vertices() const { return n; }
+    long long get_edges_count() const { return m; }
+    int get_threads() const { return threads; }
+    double get_elapsed_ms() const { return elapsed_ms; }
+};
+
+#endif // STREAMING_GENERATOR_HPP
@@ -0,0 +1,35 @@
+#ifndef THREAD_BARRIER_HPP
+#define THREAD_BARRIER_HPP
+
+#include <mutex>
+#include <condition_variable>
+
+// =====================================================
+// Barrera reutilizable para un equipo fijo de hilos
+// (std::barrier recién aparece en C++20)
+// =====================================================
+class ThreadBarrier {
+private:
+    std::mutex lock;
+    std::condition_variable cv;
+    int count;
+    int waiting = 0;
+    long long generation = 0;
+
+public:
+    explicit ThreadBarrier(int threads) : count(threads) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> guard(lock);
+        long long gen = generation;
+        if (++waiting == count) {
+            waiting = 0;
+            generation++;
+            cv.notify_all();
+            return;
+        }
+        cv.wait(guard, [&]() { return gen != generation; });
+    }
+};
+
+#endif // THREAD_BARRIER_HPP
@@ -0,0 +1,241 @@
+#ifndef VERTEX_ORDERING_HPP
+#define VERTEX_ORDERING_HPP
+
+#include "csr_graph.hpp"
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+// =====================================================
+// Reordenamiento de vértices para localidad de caché
+//
+// Los grafos generados tienen IDs aleatorios: vértices
+// vecinos quedan lejos en dist[]/pred[] y cada relajación
+// es un fallo de caché. Aquí se renumeran los vértices
+// (BFS, Reverse Cuthill-McKee u orden por grado) y se
+// construye un CSR permutado. Los resultados se traducen
+// de vuelta a los IDs originales.
+// =====================================================
+enum class VertexOrder {
+    BFS,         // orden de descubrimiento BFS desde la raíz
+    RCM,         // Reverse Cuthill-McKee (grafo no dirigido subyacente)
+    DegreeDesc   // grado de salida descendente
+};
+
+inline const char* vertex_order_name(VertexOrder order) {
+    switch (order) {
+        case VertexOrder::BFS:        return "BFS";
+        case VertexOrder::RCM:        return "RCM";
+        case VertexOrder::DegreeDesc: return "Degree";
+    }
+    return "?";
+}
+
+template<typename W, typename VId = int, typename EId = long long>
+class VertexReordering {
+public:
+    using Graph = CSRGraph<W, VId, EId>;
+
+private:
+    std::shared_ptr<const Graph> graph;  // grafo renumerado
+    std::vector<int> perm;  // perm[original] = nuevo
+    std::vector<int> inv;   // inv[nuevo] = original
+
+public:
+    VertexReordering(const Graph& original, VertexOrder order, int root = 0) {
+        int n = original.get_vertices();
+
+        switch (order) {
+            case VertexOrder::BFS:        inv = bfs_order(original, root); break;
+            case VertexOrder::RCM:        inv = rcm_order(original); break;
+            case VertexOrder::DegreeDesc: inv = degree_order(original); break;
+        }
+
+        perm.assign(n, -1);
+        for (int i = 0; i < n; ++i) {
+            perm[inv[i]] = i;
+        }
+
+        // CSR permutado: las aristas de cada vértice conservan su orden
+        std::vector<EId> offsets(n + 1, 0);
+        for (int i = 0; i < n; ++i) {
+            offsets[i + 1] = offsets[i] + original.degree(inv[i]);
+        }
+
+        std::vector<VId> targets(offsets[n]);
+        std::vector<W> weights(offsets[n]);
+        for (int i = 0; i < n; ++i) {
+            EId pos = offsets[i];
+            int u = inv[i];
+            for (EId e = original.edge_begin(u); e < original.edge_end(u); ++e) {
+                targets[pos] = static_cast<VId>(perm[original.target(e)]);
+                weights[pos] = original.weight(e);
+                ++pos;
+            }
+        }
+
+        graph = std::make_shared<const Graph>(Graph::from_arrays(
+            n, std::move(offsets), std::move(targets), std::move(weights)));
+    }
+
+    // Getters
+    const std::shared_ptr<const Graph>& get_graph() const { return graph; }
+    const std::vector<int>& get_permutation() const { return perm; }
+
+    int to_new(int v) const { return perm[v]; }
+    int to_old(int v) const { return v < 0 ? v : inv[v]; }
+
+    // Traducir dist/pred (indexados por IDs nuevos) a los IDs originales
+    template<typename T>
+    std::pair<std::vector<T>, std::vector<int>>
+    remap(const std::vector<T>& dist, const std::vector<int>& pred) const {
+        int n = perm.size();
+        std::vector<T> d(dist.empty() ? 0 : n);
+        std::vector<int> p(pred.empty() ? 0 : n);
+
+        for (int v = 0; v < (int)d.size(); ++v) {
+            d[v] = dist[perm[v]];
+        }
+        for (int v = 0; v < (int)p.size(); ++v) {
+            p[v] = to_old(pred[perm[v]]);
+        }
+        return {d, p};
+    }
+
+    // =====================================================
+    // Órdenes (devuelven inv: posición nueva -> vértice original)
+    // =====================================================
+
+    // BFS sobre aristas salientes desde root; los vértices no
+    // alcanzados se agregan con nuevas BFS en orden de ID
+    static std::vector<int> bfs_order(const Graph& g, int root) {
+        int n = g.get_vertices();
+        std::vector<int> order;
+        std::vector<bool> seen(n, false);
+        order.reserve(n);
+
+        auto bfs = [&](int s) {
+            std::size_t head = order.size();
+            seen[s] = true;
+            order.push_back(s);
+            while (head < order.size()) {
+                int u = order[head++];
+                for (EId e = g.edge_begin(u); e < g.edge_end(u); ++e) {
+                    int v = g.target(e);
+                    if (!seen[v]) {
+                        seen[v] = true;
+                        order.push_back(v);
+                    }
+                }
+            }
+        };
+
+        if (root >= 0 && root < n) bfs(root);
+        for (int s = 0; s < n; ++s) {
+            if (!seen[s]) bfs(s);
+        }
+        return order;
+    }
+
+    // Reverse Cuthill-McKee sobre el grafo no dirigido subyacente:
+    // cada componente parte del vértice de menor grado y los vecinos
+    // se visitan por grado creciente; al final se invierte el orden
+    static std::vector<int> rcm_order(const Graph& g) {
+        int n = g.get_vertices();
+        Graph rg = g.reversed();
+
+        std::vector<long long> deg(n);
+        for (int u = 0; u < n; ++u) {
+            deg[u] = g.degree(u) + rg.degree(u);
+        }
+
+        std::vector<int> by_degree(n);
+        std::iota(by_degree.begin(), by_degree.end(), 0);
+        std::stable_sort(by_degree.begin(), by_degree.end(),
+                         [&](int a, int b) { return deg[a] < deg[b]; });
+
+        std::vector<int> order;
+        std::vector<bool> seen(n, false);
+        std::vector<int> neigh;
+        order.reserve(n);
+
+        auto push_neighbors = [&](const Graph& h, int u) {
+            for (EId e = h.edge_begin(u); e < h.edge_end(u); ++e) {
+                int v = h.target(e);
+                if (!seen[v]) {
+                    seen[v] = true;
+                    neigh.push_back(v);
+                }
+            }
+        };
+
+        for (int s : by_degree) {
+            if (seen[s]) continue;
+
+            std::size_t head = order.size();
+            seen[s] = true;
+            order.push_back(s);
+
+            while (head < order.size()) {
+                int u = order[head++];
+                neigh.clear();
+                push_neighbors(g, u);
+                push_neighbors(rg, u);
+                std::stable_sort(neigh.begin(), neigh.end(),
+                                 [&](int a, int b) { return deg[a] < deg[b]; });
+                order.insert(order.end(), neigh.begin(), neigh.end());
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    // Grado de salida descendente (empates por ID)
+    static std::vector<int> degree_order(const Graph& g) {
+        int n = g.get_vertices();
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return g.degree(a) > g.degree(b);
+        });
+        return order;
+    }
+};
+
+// =====================================================
+// Adaptador: ejecuta un algoritmo (Dijkstra, bmssp,
+// BellmanFord) sobre el grafo renumerado y devuelve
+// dist/pred con los IDs originales
+// =====================================================
+template<typename Engine>
+class ReorderedEngine {
+public:
+    using T = typename Engine::distance_type;
+    using Graph = typename Engine::graph_type;
+    using Ordering = VertexReordering<typename Graph::weight_type,
+                                      typename Graph::vertex_type,
+                                      typename Graph::edge_type>;
+
+private:
+    const Ordering& ordering;
+    Engine engine;
+
+public:
+    template<typename... Args>
+    explicit ReorderedEngine(const Ordering& ord, Args&&... args)
+        : ordering(ord), engine(ord.get_graph(), std::forward<Args>(args)...) {}
+
+    template<typename... Args>
+    std::pair<std::vector<T>, std::vector<int>> execute(int source, Args&&... args) {
+        auto result = engine.execute(ordering.to_new(source), std::forward<Args>(args)...);
+        return ordering.remap(result.first, result.second);
+    }
+
+    Engine& get_engine() { return engine; }
+};
+
+#endif // VERTEX_ORDERING_HPP
@@ -0,0 +1,40 @@
+#ifndef WEIGHT_STATS_HPP
+#define WEIGHT_STATS_HPP
+
+// =====================================================
+// Distribución de pesos de un grafo (la que muestra
+// GraphLoader::print_stats). La usan los algoritmos que
+// eligen parámetros según los pesos (p. ej. el delta de
+// delta-stepping).
+// =====================================================
+struct WeightStats {
+    int vertices = 0;
+    long long edges = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+
+    // Grado de salida promedio
+    double avg_degree() const {
+        return vertices > 0 ? (double)edges / vertices : 0.0;
+    }
+
+    // Recorrer los pesos con una función f(callback) que llama
+    // callback(peso) una vez por arista
+    template<typename ForEach>
+    static WeightStats collect(int vertices, ForEach&& for_each) {
+        WeightStats s;
+        s.vertices = vertices;
+        double sum = 0.0;
+        for_each([&](double w) {
+            if (s.edges == 0 || w < s.min) s.min = w;
+            if (s.edges == 0 || w > s.max) s.max = w;
+            sum += w;
+            s.edges++;
+        });
+        s.mean = s.edges > 0 ? sum / s.edges : 0.0;
+        return s;
+    }
+};
+
+#endif // WEIGHT_STATS_HPP
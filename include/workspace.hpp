@@ -0,0 +1,88 @@
+#ifndef WORKSPACE_HPP
+#define WORKSPACE_HPP
+
+#include "csr_graph.hpp"
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+// =====================================================
+// Espacio de trabajo de una búsqueda (dist, pred, visited)
+//
+// Lo crea quien llama y se reutiliza entre consultas: la
+// primera vez se inicializa en O(n); después reset() solo
+// restaura los vértices tocados por la búsqueda anterior
+// (los que tienen dist != inf). Los resultados se leen con
+// vistas, sin copiar los arreglos.
+//
+//   SSSPWorkspace<T> ws;
+//   dij.execute(s, ws);
+//   T d = ws.distances()[t];
+// =====================================================
+template<typename T>
+struct SSSPWorkspace {
+    std::vector<T> dist;
+    std::vector<int> pred;
+    std::vector<char> visited;   // usado por BMSSP
+    std::vector<int> touched;    // vértices con dist != inf
+    T inf = std::numeric_limits<T>::max();
+
+    SSSPWorkspace() = default;
+    explicit SSSPWorkspace(int n, T infinity = std::numeric_limits<T>::max()) {
+        reset(n, infinity);
+    }
+
+    // Preparar para una búsqueda en un grafo de n vértices
+    void reset(int n, T infinity) {
+        if ((int)dist.size() != n || inf != infinity) {
+            inf = infinity;
+            dist.assign(n, inf);
+            pred.assign(n, -1);
+            visited.assign(n, 0);
+            touched.clear();
+            return;
+        }
+
+        for (int v : touched) {
+            dist[v] = inf;
+            pred[v] = -1;
+            visited[v] = 0;
+        }
+        touched.clear();
+    }
+
+    // Asignar distancia y predecesor, registrando el vértice
+    void update(int v, T d, int p) {
+        if (dist[v] == inf) touched.push_back(v);
+        dist[v] = d;
+        pred[v] = p;
+    }
+
+    // Resultados (válidos hasta la próxima búsqueda)
+    ArrayView<T> distances() const { return {dist.data(), dist.size()}; }
+    ArrayView<int> predecessors() const { return {pred.data(), pred.size()}; }
+    std::size_t touched_count() const { return touched.size(); }
+
+    bool has_path(int destination) const {
+        return destination >= 0 && destination < (int)dist.size() &&
+               dist[destination] != inf;
+    }
+
+    // Camino desde el origen hasta destination (vacío si no hay)
+    std::vector<int> get_shortest_path(int destination) const {
+        if (!has_path(destination)) {
+            return {};
+        }
+
+        std::vector<int> path;
+        for (int x = destination; x != -1; x = pred[x]) {
+            path.push_back(x);
+            if (pred[x] == x) break;   // BMSSP marca el origen como su propio pred
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+#endif // WORKSPACE_HPP
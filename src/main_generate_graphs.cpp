@@ -1,21 +1,60 @@
 #include "graph_generator.hpp"
+#include "streaming_generator.hpp"
 
 #include <iostream>
 #include <vector>
 #include <string>
 #include <filesystem>
 
-using T = long long;
+using T = int;  // pesos en [1, 100]: aristas de 12 bytes en lugar de 16
 namespace fs = std::filesystem;
 
-int main() {
+// =====================================================
+// Grafos grandes (1M - 10M vértices) para pruebas de
+// escala, con el generador por flujo. Van a data/large/
+// para que el benchmark completo no los recorra. Densidad
+// alta no: V² / 2 aristas no entran en disco
+// =====================================================
+int generate_large(bool binary, unsigned seed) {
+    using Gen = StreamingGraphGenerator<>;
+    const std::string dir = "data/large";
+    fs::create_directories(dir);
+
+    std::vector<int> sizes = {1000000, 2000000, 5000000, 10000000};
+    Gen gen(seed);
+    auto format = binary ? Gen::Format::Binary : Gen::Format::Dimacs;
+    std::string ext = binary ? ".csr" : ".gr";
+
+    for (int V : sizes) {
+        std::string base = dir + "/graph_" + std::to_string(V);
+        if (!gen.generate(base + "_low" + ext, V, Gen::low_edges(V), format, "low") ||
+            !gen.generate(base + "_medium" + ext, V, Gen::medium_edges(V), format, "medium")) {
+            return 1;
+        }
+    }
+
+    std::cout << "\nGrafos grandes generados en " << dir << "\n";
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const unsigned SEED = 42;  // seed fijo para reproducibilidad
+
+    if (argc > 1) {
+        std::string mode = argv[1];
+        std::string option = argc > 2 ? argv[2] : "";
+        if (mode == "--large" && argc <= 3 && (option.empty() || option == "--binary"))
+            return generate_large(option == "--binary", SEED);
+        std::cerr << "Uso: " << argv[0] << " [--large [--binary]]\n";
+        return 1;
+    }
+
     // Crear carpetas si no existen
     fs::create_directories("data");
 
     std::vector<int> sizes = {100, 500, 1000, 5000, 10000, 15000, 20000};
     std::vector<std::string> densities = {"low", "medium", "high"};
 
-    const unsigned SEED = 42;  // seed fijo para reproducibilidad
     GraphGenerator<T> gen(SEED);
 
     for (int V : sizes) {